@@ -18,7 +18,10 @@
 
 #include "pgmodelercliapp.h"
 #include "utilsns.h"
-#include "settings/appearanceconfigwidget.h"
+#include <QDataStream>
+#include <QTemporaryFile>
+#include <QProcess>
+#include <set>
 
 QTextStream PgModelerCliApp::out(stdout);
 
@@ -37,6 +40,7 @@ const QString PgModelerCliApp::ExportToDict("--export-to-dict");
 const QString PgModelerCliApp::ImportDb("--import-db");
 const QString PgModelerCliApp::NoIndex("--no-index");
 const QString PgModelerCliApp::Split("--split");
+const QString PgModelerCliApp::Incremental("--incremental");
 const QString PgModelerCliApp::DependenciesSql("--dependencies");
 const QString PgModelerCliApp::ChildrenSql("--children");
 const QString PgModelerCliApp::Diff("--diff");
@@ -91,8 +95,15 @@ const QString PgModelerCliApp::NoSequenceReuse("--no-sequence-reuse");
 const QString PgModelerCliApp::NoCascadeDrop("--no-cascade");
 const QString PgModelerCliApp::ForceRecreateObjs("--force-recreate-objs");
 const QString PgModelerCliApp::OnlyUnmodifiable("--only-unmodifiable");
+const QString PgModelerCliApp::CompareToSnapshot("--compare-to-snapshot");
+const QString PgModelerCliApp::DiffJobs("--diff-jobs");
 const QString PgModelerCliApp::CreateConfigs("--create-configs");
 const QString PgModelerCliApp::MissingOnly("--missing-only");
+const QString PgModelerCliApp::CreateSnapshot("--create-snapshot");
+const QString PgModelerCliApp::SnapshotHeader("pgModeler catalog snapshot");
+const QString PgModelerCliApp::Batch("--batch");
+const QString PgModelerCliApp::BatchJobs("--batch-jobs");
+const QString PgModelerCliApp::StdInput("-");
 
 const QString PgModelerCliApp::TagExpr("<%1");
 const QString PgModelerCliApp::EndTagExpr("</%1");
@@ -123,9 +134,11 @@ attribs_map PgModelerCliApp::short_opts = {
 	{ DropClusterObjs, "-dc" },	{ RevokePermissions, "-rv" },	{ DropMissingObjs, "-dm" },
 	{ ForceDropColsConstrs, "-fd" },	{ RenameDb, "-rn" },
 	{ NoSequenceReuse, "-ns" },	{ NoCascadeDrop, "-nd" },	{ ForceRecreateObjs, "-nf" },
-	{ OnlyUnmodifiable, "-nu" },	{ NoIndex, "-ni" },	{ Split, "-sp" },
+	{ OnlyUnmodifiable, "-nu" },	{ NoIndex, "-ni" },	{ Split, "-sp" },	{ Incremental, "-in" },
 	{ SystemWide, "-sw" },	{ CreateConfigs, "-cc" }, { Force, "-ff" },
-	{ MissingOnly, "-mo" }, { DependenciesSql, "-ds" }, { ChildrenSql, "-cs" }
+	{ MissingOnly, "-mo" }, { DependenciesSql, "-ds" }, { ChildrenSql, "-cs" },
+	{ CreateSnapshot, "-cn" }, { CompareToSnapshot, "-cf" }, { DiffJobs, "-dj" },
+	{ Batch, "-bt" }, { BatchJobs, "-bj" }
 };
 
 std::map<QString, bool> PgModelerCliApp::long_opts = {
@@ -148,20 +161,22 @@ std::map<QString, bool> PgModelerCliApp::long_opts = {
 	{ DropMissingObjs, false },	{ ForceDropColsConstrs, false },	{ RenameDb, false },
 	{ NoSequenceReuse, false },	{ NoCascadeDrop, false },
 	{ ForceRecreateObjs, false },	{ OnlyUnmodifiable, false },	{ ExportToDict, false },
-	{ NoIndex, false },	{ Split, false },	{ SystemWide, false },
+	{ NoIndex, false },	{ Split, false },	{ Incremental, false },	{ SystemWide, false },
 	{ CreateConfigs, false }, { Force, false }, { MissingOnly, false },
-	{ DependenciesSql, false }, { ChildrenSql, false }
+	{ DependenciesSql, false }, { ChildrenSql, false },
+	{ CreateSnapshot, false }, { CompareToSnapshot, true }, { DiffJobs, true },
+	{ Batch, true }, { BatchJobs, true }
 };
 
 std::map<QString, QStringList> PgModelerCliApp::accepted_opts = {
 	{{ Attributes::Connection }, { ConnAlias, Host, Port, User, Passwd, InitialDb }},
-	{{ ExportToFile }, { Input, Output, PgSqlVer, Split, DependenciesSql, ChildrenSql }},
-	{{ ExportToPng },  { Input, Output, ShowGrid, ShowDelimiters, PageByPage, ZoomFactor }},
-	{{ ExportToSvg },  { Input, Output, ShowGrid, ShowDelimiters }},
-	{{ ExportToDict }, { Input, Output, Split, NoIndex }},
+	{{ ExportToFile }, { Input, Output, PgSqlVer, Split, Incremental, DependenciesSql, ChildrenSql, FilterObjects, MatchByName }},
+	{{ ExportToPng },  { Input, Output, ShowGrid, ShowDelimiters, PageByPage, ZoomFactor, FilterObjects, MatchByName }},
+	{{ ExportToSvg },  { Input, Output, ShowGrid, ShowDelimiters, FilterObjects, MatchByName }},
+	{{ ExportToDict }, { Input, Output, Split, NoIndex, FilterObjects, MatchByName }},
 
 	{{ ExportToDbms }, { Input, PgSqlVer, IgnoreDuplicates, IgnoreErrorCodes,
-											 DropDatabase, DropObjects, Simulate, UseTmpNames }},
+											 DropDatabase, DropObjects, Simulate, UseTmpNames, FilterObjects, MatchByName }},
 
 	{{ ImportDb }, { InputDb, Output, IgnoreImportErrors, ImportSystemObjs, ImportExtensionObjs,
 									 FilterObjects, OnlyMatching, MatchByName, ForceChildren, DebugMode, ConnAlias,
@@ -170,7 +185,10 @@ std::map<QString, QStringList> PgModelerCliApp::accepted_opts = {
 	{{ Diff }, { Input, PgSqlVer, IgnoreDuplicates, IgnoreErrorCodes, CompareTo, PartialDiff, Force,
 							 StartDate, EndDate, SaveDiff, ApplyDiff, NoDiffPreview, DropClusterObjs, RevokePermissions,
 							 DropMissingObjs, ForceDropColsConstrs, RenameDb, NoCascadeDrop,
-							 NoSequenceReuse, ForceRecreateObjs, OnlyUnmodifiable }},
+							 NoSequenceReuse, ForceRecreateObjs, OnlyUnmodifiable, CompareToSnapshot, DiffJobs }},
+
+	{{ CreateSnapshot }, { InputDb, Output }},
+	{{ Batch }, { BatchJobs }},
 
 	{{ DbmMimeType }, { SystemWide, Force }},
 	{{ FixModel },	{ Input, Output, FixTries }},
@@ -182,12 +200,11 @@ PgModelerCliApp::PgModelerCliApp(int argc, char **argv) : Application(argc, argv
 {
 	try
 	{
-		QString op, value, orig_op;
-		bool accepts_val=false;
 		attribs_map opts;
 		QStringList args = arguments();
 
 		has_fix_log = false;
+		silent_mode = false;
 		buffer_size = 0;
 		model=nullptr;
 		scene=nullptr;
@@ -200,114 +217,128 @@ PgModelerCliApp::PgModelerCliApp(int argc, char **argv) : Application(argc, argv
 		conn_conf = nullptr;
 		rel_conf = nullptr;
 		general_conf = nullptr;
+		appearance_conf = nullptr;
 
 		// We extract the options values only if the help option is not present
 		if(args.size() > 1 && !args.contains(Help) && !args.contains(short_opts[Help]))
-		{	
-			for(int i=1; i < argc; i++)
-			{
-				op = orig_op = argv[i];
+			opts = extractOptions(args);
 
-				//If the retrieved option starts with - it will be treated as a command option
-				if(op[0]=='-')
-				{
-					value.clear();
-
-					if(i < argc-1 && argv[i+1][0]!='-')
-					{
-						//If the next option does not starts with '-', is considered a value
-						value=argv[++i];
-					}
+		//Validates and executes the options
+		parseOptions(opts);
+		configureOperation();
+	}
+	catch(Exception &e)
+	{
+		throw e;
+	}
+}
 
-					//Raises an error if the option is not recognized
-					if(!isOptionRecognized(op, accepts_val))
-						throw Exception(tr("Unrecognized option `%1'.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+attribs_map PgModelerCliApp::extractOptions(const QStringList &args)
+{
+	QString op, value, orig_op;
+	bool accepts_val=false;
+	attribs_map opts;
 
-					//Raises an error if the value is empty and the option accepts a value
-					if(accepts_val && value.isEmpty())
-						throw Exception(tr("Value not specified for option `%1'.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
-					else if(!accepts_val && !value.isEmpty())
-						throw Exception(tr("Option `%1' does not accept values.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+	for(int i=1; i < args.size(); i++)
+	{
+		op = orig_op = args[i];
 
-					/* If we find a filter object parameter we append its parameter index so
-					 * its value is not replaced by the next filter parameter found */
-					if(op == FilterObjects)
-						opts[QString("%1%2").arg(op).arg(i)] = value;
+		//If the retrieved option starts with - it will be treated as a command option
+		if(op.startsWith('-'))
+		{
+			value.clear();
 
-					opts[op] = value;
-				}
+			if(i < args.size()-1 && (!args[i+1].startsWith('-') || args[i+1] == StdInput))
+			{
+				/* If the next option does not starts with '-', is considered a value.
+				 * A single '-' is also treated as a value since it denotes the standard input */
+				value=args[++i];
 			}
+
+			//Raises an error if the option is not recognized
+			if(!isOptionRecognized(op, accepts_val))
+				throw Exception(tr("Unrecognized option `%1'.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			//Raises an error if the value is empty and the option accepts a value
+			if(accepts_val && value.isEmpty())
+				throw Exception(tr("Value not specified for option `%1'.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			else if(!accepts_val && !value.isEmpty())
+				throw Exception(tr("Option `%1' does not accept values.").arg(orig_op), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			/* If we find a filter object parameter we append its parameter index so
+			 * its value is not replaced by the next filter parameter found */
+			if(op == FilterObjects)
+				opts[QString("%1%2").arg(op).arg(i)] = value;
+
+			opts[op] = value;
 		}
+	}
 
-		//Validates and executes the options
-		parseOptions(opts);
+	return opts;
+}
 
-		if(!parsed_opts.empty())
-		{
-			model=new DatabaseModel;
-			xmlparser=model->getXMLParser();
-			silent_mode=(parsed_opts.count(Silent));
+void PgModelerCliApp::configureOperation()
+{
+	if(!parsed_opts.empty())
+	{
+		model=new DatabaseModel;
+		xmlparser=model->getXMLParser();
+		silent_mode=(parsed_opts.count(Silent));
 
-			//If the export is to png or svg loads additional configurations
-			if(parsed_opts.count(ExportToPng) || parsed_opts.count(ExportToSvg) || parsed_opts.count(ImportDb))
-			{
-				connect(model, &DatabaseModel::s_objectAdded, this, &PgModelerCliApp::handleObjectAddition);
-				connect(model, &DatabaseModel::s_objectRemoved, this, &PgModelerCliApp::handleObjectRemoval);
+		//If the export is to png or svg loads additional configurations
+		if(parsed_opts.count(ExportToPng) || parsed_opts.count(ExportToSvg) || parsed_opts.count(ImportDb))
+		{
+			connect(model, &DatabaseModel::s_objectAdded, this, &PgModelerCliApp::handleObjectAddition);
+			connect(model, &DatabaseModel::s_objectRemoved, this, &PgModelerCliApp::handleObjectRemoval);
 
-				//Load the appearance settings including grid and delimiter options
-				AppearanceConfigWidget appearance_wgt;
-				appearance_wgt.loadConfiguration();
+			connect(model, &DatabaseModel::s_objectsAdded, this, [this](std::vector<BaseObject *> objects) {
+				for(auto &obj : objects)
+					handleObjectAddition(obj);
+			});
 
-				scene=new ObjectsScene;
-				scene->setParent(this);
-				scene->setSceneRect(QRectF(0,0,2000,2000));
-			}
+			scene=new ObjectsScene;
+			scene->setParent(this);
+			scene->setSceneRect(QRectF(0,0,2000,2000));
+		}
 
-			if(parsed_opts.count(ExportToDbms) || parsed_opts.count(ImportDb) || parsed_opts.count(Diff))
-			{
-				configureConnection(false);
+		if(parsed_opts.count(ExportToDbms) || parsed_opts.count(ImportDb) ||
+			 parsed_opts.count(Diff) || parsed_opts.count(CreateSnapshot))
+		{
+			configureConnection(false);
 
-				//Replacing the initial db parameter for the input database when reverse engineering
-				if((parsed_opts.count(ImportDb) || parsed_opts.count(Diff)) && !parsed_opts[InputDb].isEmpty())
-					connection.setConnectionParam(Connection::ParamDbName, parsed_opts[InputDb]);
-			}
+			//Replacing the initial db parameter for the input database when reverse engineering
+			if((parsed_opts.count(ImportDb) || parsed_opts.count(Diff) || parsed_opts.count(CreateSnapshot)) &&
+				 !parsed_opts[InputDb].isEmpty())
+				connection.setConnectionParam(Connection::ParamDbName, parsed_opts[InputDb]);
+		}
 
-			if(parsed_opts.count(Diff))
-			{
-				configureConnection(true);
+		if(parsed_opts.count(Diff))
+		{
+			configureConnection(true);
 
-				if(!extra_connection.isConfigured())
-					extra_connection = connection;
+			if(!extra_connection.isConfigured())
+				extra_connection = connection;
 
-				extra_connection.setConnectionParam(Connection::ParamDbName, parsed_opts[CompareTo]);
-			}
+			extra_connection.setConnectionParam(Connection::ParamDbName, parsed_opts[CompareTo]);
+		}
 
-			if(!silent_mode && export_hlp && import_hlp && diff_hlp)
-			{
-				connect(export_hlp, &ModelExportHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress);
-				connect(export_hlp, &ModelExportHelper::s_errorIgnored, this,  &PgModelerCliApp::printIgnoredError);
-				connect(import_hlp, &DatabaseImportHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress);
-				connect(diff_hlp, &ModelsDiffHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress);
-			}
+		if(!silent_mode && export_hlp && import_hlp && diff_hlp)
+		{
+			connect(export_hlp, &ModelExportHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress);
+			connect(export_hlp, &ModelExportHelper::s_errorIgnored, this,  &PgModelerCliApp::printIgnoredError);
+			connect(import_hlp, &DatabaseImportHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress);
+			connect(diff_hlp, &ModelsDiffHelper::s_progressUpdated, this, &PgModelerCliApp::updateProgress);
 		}
 	}
-	catch(Exception &e)
-	{
-		throw e;
-	}
 }
 
-PgModelerCliApp::~PgModelerCliApp()
+void PgModelerCliApp::resetOperation()
 {
-	bool show_flush_msg = model && model->getObjectCount() > 0;
-
-	if(show_flush_msg)
-		printMessage(tr("Flushing used memory..."));
-
 	if(scene)
 		delete scene;
 
-	delete model;
+	if(model)
+		delete model;
 
 	if(export_hlp)
 		delete export_hlp;
@@ -318,6 +349,35 @@ PgModelerCliApp::~PgModelerCliApp()
 	if(diff_hlp)
 		delete diff_hlp;
 
+	model = nullptr;
+	scene = nullptr;
+	xmlparser = nullptr;
+	export_hlp = nullptr;
+	import_hlp = nullptr;
+	diff_hlp = nullptr;
+
+	has_fix_log = false;
+	buffer_size = 0;
+	zoom = 1;
+	parsed_opts.clear();
+	objs_xml.clear();
+	obj_filters.clear();
+	member_roles.clear();
+	changelog.clear();
+	model_version.clear();
+	start_date = end_date = QDateTime();
+	connection = extra_connection = Connection();
+}
+
+PgModelerCliApp::~PgModelerCliApp()
+{
+	bool show_flush_msg = model && model->getObjectCount() > 0;
+
+	if(show_flush_msg)
+		printMessage(tr("Flushing used memory..."));
+
+	resetOperation();
+
 	if(conn_conf)
 		delete conn_conf;
 
@@ -327,6 +387,9 @@ PgModelerCliApp::~PgModelerCliApp()
 	if(general_conf)
 		delete general_conf;
 
+	if(appearance_conf)
+		delete appearance_conf;
+
 	if(show_flush_msg)
 		printMessage(tr("Done!"));
 }
@@ -420,11 +483,13 @@ void PgModelerCliApp::showMenu()
 	printText(tr("  %1, %2\t\t    Lists the available connections in file %3.").arg(short_opts[ListConns]).arg(ListConns).arg(GlobalAttributes::ConnectionsConf + GlobalAttributes::ConfigurationExt));
 	printText(tr("  %1, %2\t\t    Importa a database to an output file.").arg(short_opts[ImportDb]).arg(ImportDb));
 	printText(tr("  %1, %2\t\t\t    Compares a model and a database or two databases generating the SQL script to sync the latter in relation to the first.").arg(short_opts[Diff]).arg(Diff));
+	printText(tr("  %1, %2\t    Imports a database to a catalog snapshot file that can be used in place of the compared database in diff operations.").arg(short_opts[CreateSnapshot]).arg(CreateSnapshot));
 	printText(tr("  %1, %2\t\t    Tries to fix the structure of the input model file to make it loadable again.").arg(short_opts[FixModel]).arg(FixModel));
 	printText(tr("  %1, %2\t\t    Creates the pgModeler's configuration folder and files in the user's local storage.").arg(short_opts[CreateConfigs]).arg(CreateConfigs));
 #ifndef Q_OS_MAC
 	printText(tr("  %1, %2 [ACTION]\t    Handles the DBM file association to pgModeler binaries. The ACTION can be [%3 | %4].").arg(short_opts[DbmMimeType]).arg(DbmMimeType).arg(Install).arg(Uninstall));
 #endif
+	printText(tr("  %1, %2 [FILE]\t    Runs the jobs listed in the batch file (one command line per row) in a single process. Use `%3' to read the jobs from the standard input.").arg(short_opts[Batch], Batch, StdInput));
 	printText(tr("  %1, %2\t\t\t    Shows this help menu.").arg(short_opts[Help]).arg(Help));
 	printText();
 
@@ -440,6 +505,7 @@ void PgModelerCliApp::showMenu()
 	printText(tr("  %1, %2\t\t\t    The SQL file is generated per object. The files will be named in such a way to reflect the correct creation order of the objects.").arg(short_opts[Split]).arg(Split));
 	printText(tr("  %1, %2\t\t    Includes the object's dependencies SQL code in the generated file. (Only for split mode)").arg(short_opts[DependenciesSql]).arg(DependenciesSql));
 	printText(tr("  %1, %2\t\t    Includes the object's children SQL code in the generated file. (Only for split mode)").arg(short_opts[ChildrenSql]).arg(ChildrenSql));
+	printText(tr("  %1, %2\t\t    Rewrites only the files whose contents changed since the last export and removes the obsolete ones. (Only for split mode)").arg(short_opts[Incremental]).arg(Incremental));
 	printText();
 
 	printText(tr("PNG and SVG export options: "));
@@ -483,8 +549,13 @@ void PgModelerCliApp::showMenu()
 	printText(tr("  %1, %2\t\t    Runs the import in debug mode printing all queries executed in the server.").arg(short_opts[DebugMode]).arg(DebugMode));
 	printText();
 
+	printText(tr("Batch options: "));
+	printText(tr("  %1, %2 [NUMBER]\t    Number of processes used to run the jobs in parallel. By default, the jobs run sequentially in a single process.").arg(short_opts[BatchJobs]).arg(BatchJobs));
+	printText();
+
 	printText(tr("Diff options: "));
 	printText(tr("  %1, %2 [DBNAME]\t    The database used in the comparison. All the SQL code generated is applied to it.").arg(short_opts[CompareTo]).arg(CompareTo));
+	printText(tr("  %1, %2 [FILE] Uses a catalog snapshot file (see %3) in the comparison instead of importing the database.").arg(short_opts[CompareToSnapshot], CompareToSnapshot, CreateSnapshot));
 	printText(tr("  %1, %2\t\t    Switches to the partial diff operation. A set of object filters should be provided using the import option %3.").arg(short_opts[PartialDiff]).arg(PartialDiff).arg(FilterObjects));
 	printText(tr("  %1, %2\t\t\t    Forces a full diff if the provided filters were not able to retrieve objects for a partial diff operation.").arg(short_opts[Force]).arg(Force));
 	printText(tr("  %1, %2\t\t    Matches all database model objects in which the modification date starts on the specified date. (Only for partial diff)").arg(short_opts[StartDate]).arg(StartDate));
@@ -501,6 +572,7 @@ void PgModelerCliApp::showMenu()
 	printText(tr("  %1, %2\t    Don't reuse sequences on serial columns. Drop the old sequence assigned to a serial column and creates a new one.").arg(short_opts[NoSequenceReuse]).arg(NoSequenceReuse));
 	printText(tr("  %1, %2\t    Forces recreating the objects. Instead of an ALTER command, the DROP and CREATE commands are used to create new versions of the objects.").arg(short_opts[ForceRecreateObjs]).arg(ForceRecreateObjs));
 	printText(tr("  %1, %2\t    Recreates only the unmodifiable objects. These objects are the ones that can't be changed via ALTER command.").arg(short_opts[OnlyUnmodifiable]).arg(OnlyUnmodifiable));
+	printText(tr("  %1, %2 [NUMBER]\t    Number of worker threads used to compare the objects. Use 0 to start one thread per CPU core. (Default: 1)").arg(short_opts[DiffJobs]).arg(DiffJobs));
 	printText();
 
 	printText(tr("Model fix options: ") );
@@ -566,6 +638,7 @@ void PgModelerCliApp::showMenu()
 	printText(tr("     > Use the special keyword `%1' to force all children objects.").arg(AllChildren) );
 	printText();
 	printText(tr("   * NOTES: all comparisons during the filtering process are case insensitive."));
+	printText(tr("     The filters can also be used in the export operations. In that case, only the matching objects and their dependencies are loaded from the input model and exported."));
 	printText(tr("     Using the filtering options may cause the importing of additional objects due to the automatic dependency resolution."));
 	printText();
 	printText(tr("** The diff process allows the usage of all options related to the import operation."));
@@ -579,6 +652,15 @@ void PgModelerCliApp::showMenu()
 	printText(tr("   A second connection can be specified by appending a 1 to any connection configuration parameter listed above."));
 	printText(tr("   This causes the connection to be associated to %1 exclusively.").arg(CompareTo));
 	printText();
+	printText(tr("** When comparing to a catalog snapshot (%1) no connection to the compared database is made.").arg(CompareToSnapshot));
+	printText(tr("   To apply the diff code the option %1 must be provided as well. The partial diff can't be used with snapshots.").arg(CompareTo));
+	printText(tr("   The snapshot is created using the same options and connection parameters of the import operation."));
+	printText();
+	printText(tr("** Each job in a batch file is a regular set of options, e.g.: %1 model.dbm %2 model.sql").arg(Input, Output));
+	printText(tr("   Empty rows and rows starting with # are ignored. Values containing spaces must be quoted."));
+	printText(tr("   The configurations and connections are loaded once and reused by all jobs. A failed job doesn't abort the remaining ones."));
+	printText(tr("   When using %1 the jobs are distributed among separated processes so they must not depend on each other.").arg(BatchJobs));
+	printText();
 }
 
 void PgModelerCliApp::listConnections()
@@ -607,27 +689,46 @@ void PgModelerCliApp::listConnections()
 void PgModelerCliApp::parseOptions(attribs_map &opts)
 {
 	//Loading connections
-	if(opts.count(ListConns) || opts.count(ExportToDbms) || opts.count(ImportDb) || opts.count(Diff))
+	if(opts.count(ListConns) || opts.count(ExportToDbms) || opts.count(ImportDb) ||
+		 opts.count(Diff) || opts.count(CreateSnapshot))
 	{
-		conn_conf = new ConnectionsConfigWidget;
-		conn_conf->loadConfiguration();
-		conn_conf->getConnections(connections, false);
+		/* In batch mode the connections are loaded only once by the first job that needs them
+		 * so the subsequent jobs reuse the same configuration */
+		if(!conn_conf)
+		{
+			conn_conf = new ConnectionsConfigWidget;
+			conn_conf->loadConfiguration();
+			conn_conf->getConnections(connections, false);
+		}
 	}
 	//Loading general and relationship settings when exporting to image formats
 	else if(opts.count(ExportToPng) || opts.count(ExportToSvg))
 	{
-		general_conf = new GeneralConfigWidget;
-		rel_conf = new RelationshipConfigWidget;
+		if(!general_conf)
+		{
+			general_conf = new GeneralConfigWidget;
+			general_conf->loadConfiguration();
+		}
 
-		general_conf->loadConfiguration();
-		rel_conf->loadConfiguration();
+		if(!rel_conf)
+		{
+			rel_conf = new RelationshipConfigWidget;
+			rel_conf->loadConfiguration();
+		}
+	}
+
+	//Loading the appearance settings (including grid and delimiter options) when the objects' graphical representation is used
+	if((opts.count(ExportToPng) || opts.count(ExportToSvg) || opts.count(ImportDb)) && !appearance_conf)
+	{
+		appearance_conf = new AppearanceConfigWidget;
+		appearance_conf->loadConfiguration();
 	}
 
 	//Creating the export/import/diff helpers when one of the operations are specified
 	if(opts.count(ExportToDbms) || opts.count(ExportToFile) ||
 		 opts.count(ExportToPng) || opts.count(ExportToSvg) ||
 		 opts.count(ExportToDict) || opts.count(ImportDb) ||
-		 opts.count(Diff))
+		 opts.count(Diff) || opts.count(CreateSnapshot))
 	{
 		export_hlp = new ModelExportHelper;
 		import_hlp = new DatabaseImportHelper;
@@ -645,8 +746,10 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 				import_db = (opts.count(ImportDb) > 0),
 				diff = (opts.count(Diff) > 0),
 				create_configs= (opts.count(CreateConfigs) > 0),
+				create_snapshot = (opts.count(CreateSnapshot) > 0),
 				list_conns = (opts.count(ListConns) > 0),
-				export_dbms = (opts.count(ExportToDbms) > 0);
+				export_dbms = (opts.count(ExportToDbms) > 0),
+				batch = (opts.count(Batch) > 0);
 
 		for(auto &itr : accepted_opts)
 		{
@@ -672,19 +775,19 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 		if(other_modes_cnt==0 && exp_mode_cnt==0)
 			throw Exception(tr("No operation mode was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		
-		if((exp_mode_cnt > 0 && (fix_model || upd_mime || import_db || diff || create_configs || list_conns)) || (exp_mode_cnt==0 && other_modes_cnt > 1))
+		if((exp_mode_cnt > 0 && (fix_model || upd_mime || import_db || diff || create_configs || create_snapshot || list_conns || batch)) || (exp_mode_cnt==0 && other_modes_cnt > 1))
 			throw Exception(tr("Multiple operation modes were specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		
 		if(!fix_model && !upd_mime && exp_mode_cnt > 1)
 			throw Exception(tr("Multiple export modes were specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		
-		if(!list_conns && !upd_mime && !import_db && !diff && !create_configs && !opts.count(Input))
+		if(!list_conns && !upd_mime && !import_db && !diff && !create_configs && !create_snapshot && !batch && !opts.count(Input))
 			throw Exception(tr("No input file was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		if(import_db && !opts.count(InputDb))
+		if((import_db || create_snapshot) && !opts.count(InputDb))
 			throw Exception(tr("No input database was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-		if(!opts.count(ExportToDbms) && !upd_mime && !list_conns && !diff && !create_configs && !opts.count(Output))
+		if(!opts.count(ExportToDbms) && !upd_mime && !list_conns && !diff && !create_configs && !batch && !opts.count(Output))
 			throw Exception(tr("No output file was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		
 		if(!opts.count(ExportToDbms) && !upd_mime && !import_db && !list_conns && !create_configs &&
@@ -713,6 +816,23 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 				throw Exception(tr("The options `%1' and `%2' can't be used at the same time!").arg(DependenciesSql, ChildrenSql), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 		}
 
+		if(opts.count(Incremental) && (!opts.count(ExportToFile) || !opts.count(Split)))
+			throw Exception(tr("The option `%1' must be used together with the split mode option `%2'!").arg(Incremental, Split), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		/* When exporting to a DBMS using object filters only a part of the model is loaded and exported,
+		 * so dropping the database or the objects would destroy everything in the server that wasn't loaded */
+		if(opts.count(ExportToDbms) && opts.count(FilterObjects) && (opts.count(DropDatabase) || opts.count(DropObjects)))
+			throw Exception(tr("The options `%1' and `%2' can't be used together with the object filters in option `%3'!").arg(DropDatabase, DropObjects, FilterObjects), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		if(batch && opts.count(BatchJobs))
+		{
+			bool is_num = false;
+			unsigned jobs = opts[BatchJobs].toUInt(&is_num);
+
+			if(!is_num || jobs == 0)
+				throw Exception(tr("Invalid number of jobs `%1' in option `%2'!").arg(opts[BatchJobs], BatchJobs), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		}
+
 		if(diff)
 		{
 			if(!opts.count(Input) && !opts.count(InputDb))
@@ -721,8 +841,23 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 			if(opts.count(Input) && opts.count(InputDb))
 				throw Exception(tr("The input file and the input database can't be used at the same time!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-			if(!opts.count(CompareTo))
-				throw Exception(tr("No database to be compared was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			if(!opts.count(CompareTo) && !opts.count(CompareToSnapshot))
+				throw Exception(tr("No database or catalog snapshot to be compared was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			if(opts.count(CompareToSnapshot) && opts.count(ApplyDiff) && !opts.count(CompareTo))
+				throw Exception(tr("The option `%1' must be used together with `%2' to apply the diff code of a catalog snapshot comparison!").arg(CompareTo, CompareToSnapshot), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			if(opts.count(DiffJobs))
+			{
+				bool is_num = false;
+				opts[DiffJobs].toUInt(&is_num);
+
+				if(!is_num)
+					throw Exception(tr("Invalid number of jobs `%1' in option `%2'!").arg(opts[DiffJobs], DiffJobs), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+			}
+
+			if(opts.count(CompareToSnapshot) && opts.count(PartialDiff))
+				throw Exception(tr("The partial diff can't be used when comparing to a catalog snapshot!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 			if(!opts.count(SaveDiff) && !opts.count(ApplyDiff))
 				throw Exception(tr("No diff action (save or apply) was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
@@ -780,6 +915,12 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 		if(opts.count(Output))
 			opts[Output]=QFileInfo(opts[Output]).absoluteFilePath();
 
+		if(opts.count(CompareToSnapshot))
+			opts[CompareToSnapshot]=QFileInfo(opts[CompareToSnapshot]).absoluteFilePath();
+
+		if(batch && opts[Batch] != StdInput)
+			opts[Batch]=QFileInfo(opts[Batch]).absoluteFilePath();
+
 		/* Special treatment for filter parameters:
 		 * Since it can be specified several filter parameter we need to join
 		 * everything in a single string list so it can be passed to the import helper correctly */
@@ -799,12 +940,12 @@ void PgModelerCliApp::parseOptions(attribs_map &opts)
 		QStringList acc_opts = accepted_opts[curr_op_mode];
 		QString long_opt;
 
-		// Diff, import and export (to DBMS) share the same connection options
-		if(diff || import_db || export_dbms)
+		// Diff, import, snapshot creation and export (to DBMS) share the same connection options
+		if(diff || import_db || create_snapshot || export_dbms)
 			acc_opts.append(accepted_opts[Attributes::Connection]);
 
-		// Diff also accepts all import parameters
-		if(diff)
+		// Diff and snapshot creation also accept all import parameters
+		if(diff || create_snapshot)
 			acc_opts.append(accepted_opts[ImportDb]);
 
 		for(auto &itr : opts)
@@ -835,20 +976,10 @@ int PgModelerCliApp::exec()
 		{
 			showVersionInfo();
 
-			if(parsed_opts.count(ListConns))
-				listConnections();
-			else if(parsed_opts.count(FixModel))
-				fixModel();
-			else if(parsed_opts.count(DbmMimeType))
-				updateMimeType();
-			else if(parsed_opts.count(CreateConfigs))
-				createConfigurations();
-			else if(parsed_opts.count(ImportDb))
-				importDatabase();
-			else if(parsed_opts.count(Diff))
-				diffModelDatabase();
-			else
-				exportModel();
+			if(parsed_opts.count(Batch))
+				return runBatch();
+
+			runOperation();
 		}
 
 		return 0;
@@ -859,6 +990,213 @@ int PgModelerCliApp::exec()
 	}
 }
 
+void PgModelerCliApp::runOperation()
+{
+	if(parsed_opts.count(ListConns))
+		listConnections();
+	else if(parsed_opts.count(FixModel))
+		fixModel();
+	else if(parsed_opts.count(DbmMimeType))
+		updateMimeType();
+	else if(parsed_opts.count(CreateConfigs))
+		createConfigurations();
+	else if(parsed_opts.count(ImportDb))
+		importDatabase();
+	else if(parsed_opts.count(Diff))
+		diffModelDatabase();
+	else if(parsed_opts.count(CreateSnapshot))
+		createSnapshot();
+	else
+		exportModel();
+}
+
+QStringList PgModelerCliApp::readBatchJobs(const QString &filename)
+{
+	QFile input;
+	QStringList jobs;
+	QString line;
+
+	if(filename == StdInput)
+		input.open(stdin, QFile::ReadOnly | QFile::Text);
+	else
+	{
+		input.setFileName(filename);
+		input.open(QFile::ReadOnly | QFile::Text);
+	}
+
+	if(!input.isOpen())
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(filename),
+										ErrorCode::FileDirectoryNotAccessed,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	QTextStream in(&input);
+
+	while(!in.atEnd())
+	{
+		line = in.readLine().trimmed();
+
+		// Blank lines and comments (starting with #) are ignored
+		if(line.isEmpty() || line.startsWith('#'))
+			continue;
+
+		jobs.append(line);
+	}
+
+	input.close();
+	return jobs;
+}
+
+int PgModelerCliApp::runBatch()
+{
+	QStringList jobs = readBatchJobs(parsed_opts[Batch]);
+	unsigned batch_jobs = parsed_opts.count(BatchJobs) ? parsed_opts[BatchJobs].toUInt() : 1;
+	bool batch_silent = silent_mode;
+
+	if(jobs.isEmpty())
+	{
+		printMessage(tr("No jobs found in the batch file."));
+		return 0;
+	}
+
+	if(batch_jobs > 1 && jobs.size() > 1)
+		return runBatchParallel(jobs, batch_jobs);
+
+	attribs_map opts;
+	QStringList failed_jobs;
+	int job_id = 0;
+
+	for(auto &job : jobs)
+	{
+		job_id++;
+
+		try
+		{
+			/* Destroying the model and helpers of the previous job. The loaded configurations
+			 * and connections are kept so they don't need to be reloaded for each job */
+			resetOperation();
+
+			printMessage(tr("Running job %1 of %2: %3").arg(job_id).arg(jobs.size())
+									 .arg(QString(job).replace(PasswordRegExp, PasswordPlaceholder)));
+
+			opts = extractOptions(QStringList { applicationFilePath() } + QProcess::splitCommand(job));
+
+			if(opts.count(Batch))
+				throw Exception(tr("The option `%1' can't be used inside a batch file!").arg(Batch), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			if(opts.empty() || opts.count(Help))
+				throw Exception(tr("No operation mode was specified!"), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			if(batch_silent)
+				opts[Silent] = "";
+
+			parseOptions(opts);
+			configureOperation();
+			runOperation();
+		}
+		catch(Exception &e)
+		{
+			failed_jobs.append(QString::number(job_id));
+			printText();
+			printText(e.getExceptionsText());
+			printText(tr("** Job %1 aborted due to critical error(s). **").arg(job_id));
+			printText();
+		}
+	}
+
+	silent_mode = batch_silent;
+
+	if(!failed_jobs.isEmpty())
+	{
+		printText(tr("Batch finished: %1 of %2 job(s) failed (%3).").arg(failed_jobs.size()).arg(jobs.size()).arg(failed_jobs.join(", ")));
+		return -1;
+	}
+
+	printMessage(tr("Batch finished: %1 job(s) executed successfully.").arg(jobs.size()));
+	return 0;
+}
+
+int PgModelerCliApp::runBatchParallel(const QStringList &jobs, unsigned batch_jobs)
+{
+	std::vector<QTemporaryFile *> job_files;
+	std::vector<QProcess *> procs;
+	QStringList failed_procs;
+	int proc_id = 0;
+
+	batch_jobs = std::min<unsigned>(batch_jobs, jobs.size());
+
+	printMessage(tr("Distributing %1 job(s) among %2 processes...").arg(jobs.size()).arg(batch_jobs));
+
+	try
+	{
+		/* The jobs are distributed in a round-robin fashion in temporary batch files,
+		 * each one being executed sequentially by a child pgmodeler-cli process */
+		for(unsigned idx = 0; idx < batch_jobs; idx++)
+		{
+			QTemporaryFile *tmp_file = new QTemporaryFile(GlobalAttributes::getTemporaryFilePath("batch_XXXXXX.txt"));
+			job_files.push_back(tmp_file);
+
+			if(!tmp_file->open())
+				throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(tmp_file->fileTemplate()),
+												ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+			for(qsizetype job_idx = idx; job_idx < jobs.size(); job_idx += batch_jobs)
+				tmp_file->write(jobs[job_idx].toUtf8() + "\n");
+
+			tmp_file->close();
+		}
+
+		for(auto &tmp_file : job_files)
+		{
+			QProcess *proc = new QProcess;
+			QStringList args = { Batch, tmp_file->fileName() };
+
+			if(silent_mode)
+				args.append(Silent);
+
+			procs.push_back(proc);
+			proc->setProcessChannelMode(QProcess::ForwardedChannels);
+			proc->start(applicationFilePath(), args);
+		}
+
+		for(auto &proc : procs)
+		{
+			proc_id++;
+			proc->waitForFinished(-1);
+
+			if(proc->exitStatus() != QProcess::NormalExit || proc->exitCode() != 0)
+				failed_procs.append(QString::number(proc_id));
+		}
+	}
+	catch(Exception &e)
+	{
+		for(auto &proc : procs)
+		{
+			proc->kill();
+			proc->waitForFinished();
+			delete proc;
+		}
+
+		for(auto &tmp_file : job_files)
+			delete tmp_file;
+
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+	}
+
+	for(auto &proc : procs)
+		delete proc;
+
+	for(auto &tmp_file : job_files)
+		delete tmp_file;
+
+	if(!failed_procs.isEmpty())
+	{
+		printText(tr("Batch finished: %1 of %2 process(es) reported failed job(s).").arg(failed_procs.size()).arg(procs.size()));
+		return -1;
+	}
+
+	printMessage(tr("Batch finished: %1 job(s) executed successfully.").arg(jobs.size()));
+	return 0;
+}
+
 void PgModelerCliApp::updateProgress(int progress, QString msg, ObjectType)
 {
 	if(progress > 0)
@@ -1156,9 +1494,191 @@ void PgModelerCliApp::extractObjectXML()
 	}
 }
 
+void PgModelerCliApp::extractXMLReferences(const QString &obj_xml, QStringList &obj_names, QStringList &ref_names)
+{
+	static const QRegularExpression root_regexp("^(\\s)*(<)([a-z]|\\-)+"),
+			name_regexp(QString("(\\s%1=\")([^\"]*)(\")").arg(Attributes::Name)),
+			attr_regexp(QString("(%1|%2|%3|%4|%5|%6|%7|%8)(=\")([^\"]*)(\")")
+									.arg(Attributes::Name, Attributes::Signature, Attributes::Table, Attributes::SrcTable,
+											 Attributes::DstTable, Attributes::RefTable, Attributes::OwnerColumn, Attributes::Sequence));
+	QRegularExpressionMatch match=root_regexp.match(obj_xml);
+	QRegularExpressionMatchIterator itr;
+	QString obj_name, sch_name, name, sch_attr=TagExpr.arg(Attributes::Schema) + QString(" %1=\"").arg(Attributes::Name);
+	ObjectType obj_type=ObjectType::BaseObject;
+	int root_end=-1, pos=-1;
+
+	obj_names.clear();
+	ref_names.clear();
+
+	if(!match.hasMatch())
+		return;
+
+	obj_type=BaseObject::getObjectType(match.captured().trimmed().remove('<'));
+	root_end=obj_xml.indexOf('>', match.capturedEnd());
+
+	if(root_end < 0)
+		return;
+
+	// Relationships and table children are never referenced by name by other objects
+	if(obj_type!=ObjectType::Relationship && !TableObject::isTableObject(obj_type))
+	{
+		match=name_regexp.match(obj_xml.mid(0, root_end));
+		obj_name=match.captured(2);
+
+		// The object's schema is declared in the first <schema name=""/> child element
+		pos=(obj_type!=ObjectType::Schema ? obj_xml.indexOf(sch_attr, root_end) : -1);
+
+		if(pos >= 0)
+		{
+			pos+=sch_attr.size();
+			sch_name=obj_xml.mid(pos, obj_xml.indexOf('"', pos) - pos);
+		}
+
+		obj_name.remove("&quot;");
+		sch_name.remove("&quot;");
+
+		if(!obj_name.isEmpty())
+		{
+			/* Extensions are also referenced without their schema names
+			 * by the data types they create (see recreateObjects()) */
+			if(sch_name.isEmpty() || obj_type==ObjectType::Extension)
+				obj_names.append(obj_name);
+
+			if(!sch_name.isEmpty())
+				obj_names.append(sch_name + "." + obj_name);
+		}
+	}
+
+	// Collecting the names referenced in the attributes of the child elements
+	itr=attr_regexp.globalMatch(obj_xml, root_end);
+
+	while(itr.hasNext())
+	{
+		match=itr.next();
+		name=match.captured(3);
+		name.remove("&quot;");
+
+		// Signatures like schema.func(type,...) or schema.opclass USING method are reduced to the object's name
+		pos=name.indexOf('(');
+
+		if(pos < 0)
+			pos=name.indexOf(" USING ");
+
+		if(pos >= 0)
+			name.truncate(pos);
+
+		name=name.trimmed();
+
+		if(!name.isEmpty())
+			ref_names.append(name);
+	}
+}
+
+void PgModelerCliApp::sortObjectsXML()
+{
+	std::map<QString, std::vector<int>> providers;
+	std::vector<std::vector<int>> dependents;
+	std::vector<QStringList> obj_refs;
+	std::vector<int> pending;
+	std::vector<bool> created;
+	std::set<int> ready, remaining;
+	QStringList obj_names, ref_names, fks, sorted_xml;
+	QString table_tag=TagExpr.arg(BaseObject::getSchemaName(ObjectType::Table));
+	int idx=0, obj_cnt=0, cycle_cnt=0;
+
+	printMessage(tr("Sorting objects by their dependencies..."));
+
+	/* Fixing the objects' attributes before extracting their references.
+	 * Note that fixObjectAttributes() may append new objects to the list */
+	for(idx=0; idx < objs_xml.size(); idx++)
+	{
+		fixObjectAttributes(objs_xml[idx]);
+
+		//Extracting the foreign keys from tables since they must be created after all the other objects
+		if(objs_xml[idx].startsWith(table_tag))
+			fks.append(extractForeignKeys(objs_xml[idx]));
+
+		extractXMLReferences(objs_xml[idx], obj_names, ref_names);
+		obj_refs.push_back(ref_names);
+
+		for(auto &name : obj_names)
+			providers[name].push_back(idx);
+	}
+
+	obj_cnt=objs_xml.size();
+	dependents.resize(obj_cnt);
+	pending.resize(obj_cnt, 0);
+	created.resize(obj_cnt, false);
+
+	//Building the dependency graph
+	for(idx=0; idx < obj_cnt; idx++)
+	{
+		std::set<int> deps;
+
+		for(auto &name : obj_refs[idx])
+		{
+			auto itr=providers.find(name);
+
+			//References to columns (schema.table.column) are resolved to the parent table
+			if(itr==providers.end() && name.count('.') > 1)
+				itr=providers.find(name.left(name.lastIndexOf('.')));
+
+			if(itr==providers.end())
+				continue;
+
+			for(auto &prov_idx : itr->second)
+			{
+				if(prov_idx!=idx)
+					deps.insert(prov_idx);
+			}
+		}
+
+		for(auto &dep_idx : deps)
+			dependents[dep_idx].push_back(idx);
+
+		pending[idx]=deps.size();
+		remaining.insert(idx);
+
+		if(deps.empty())
+			ready.insert(idx);
+	}
+
+	/* Creating the topological order. The ready objects are always consumed in their original order
+	 * so if the input model is already correctly ordered it'll stay untouched. When no object is ready
+	 * there is a circular reference, so the first remaining object is used to break the cycle */
+	while(!remaining.empty())
+	{
+		if(ready.empty())
+		{
+			ready.insert(*remaining.begin());
+			cycle_cnt++;
+		}
+
+		idx=*ready.begin();
+		ready.erase(ready.begin());
+		remaining.erase(idx);
+		created[idx]=true;
+		sorted_xml.append(objs_xml[idx]);
+
+		for(auto &dep_idx : dependents[idx])
+		{
+			pending[dep_idx]--;
+
+			if(pending[dep_idx]==0 && !created[dep_idx])
+				ready.insert(dep_idx);
+		}
+	}
+
+	if(cycle_cnt > 0)
+		printMessage(tr("** WARNING: Circular references detected in %1 object(s)! Their creation order can't be guaranteed.").arg(cycle_cnt));
+
+	objs_xml=sorted_xml;
+	objs_xml.append(fks);
+}
+
 void PgModelerCliApp::recreateObjects()
 {
-	QStringList fail_objs, constr, list;
+	QStringList fail_objs;
 	QString xml_def, aux_def, start_tag = "<%1", end_tag = "</%1>", aux_tag, type_tag = "<type name=\"%1\"";
 	BaseObject *object=nullptr;
 	ObjectType obj_type=ObjectType::BaseObject;
@@ -1175,6 +1695,7 @@ void PgModelerCliApp::recreateObjects()
 		max_tries=1;
 
 	model->createSystemObjects(false);
+	sortObjectsXML();
 
 	while(!objs_xml.isEmpty())
 	{
@@ -1189,7 +1710,6 @@ void PgModelerCliApp::recreateObjects()
 		{
 			xml_def = objs_xml.front();
 			objs_xml.pop_front();
-			fixObjectAttributes(xml_def);
 		}
 
 		/* Replacing the tags [<type name="extension_type"] by [<type name="schema.extension_type"]
@@ -1209,21 +1729,6 @@ void PgModelerCliApp::recreateObjects()
 				model->configureDatabase(attribs);
 			else
 			{
-				if(obj_type==ObjectType::Table)
-				{
-					//Before create a table extract it's foreign keys
-					list=extractForeignKeys(xml_def);
-
-					/* If fks were extracted insert them on the main constraints list
-					 * and restarts the XMLParser with the modified buffer */
-					if(!list.isEmpty())
-					{
-						constr.append(list);
-						xmlparser->restartParser();
-						xmlparser->loadXMLBuffer(xml_def);
-					}
-				}
-
 				//Discarding fk relationships
 				if(obj_type!=ObjectType::Relationship ||
 						(obj_type==ObjectType::Relationship && !xml_def.contains(QString("\"%1\"").arg(Attributes::RelationshipFk))))
@@ -1289,6 +1794,7 @@ void PgModelerCliApp::recreateObjects()
 																	.arg(aux_tag, UtilsNs::convertToXmlEntities(object->getName(true))));
 								}
 
+								fixObjectAttributes(aux_def);
 								objs_xml.push_back(aux_def);
 							}
 						}
@@ -1320,7 +1826,7 @@ void PgModelerCliApp::recreateObjects()
 				throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 		}
 
-		if(objs_xml.isEmpty() && (!fail_objs.isEmpty() || !constr.isEmpty()))
+		if(objs_xml.isEmpty() && !fail_objs.isEmpty())
 		{
 			tries++;
 
@@ -1344,9 +1850,7 @@ void PgModelerCliApp::recreateObjects()
 				printMessage(tr("** WARNING: There are objects that maybe can't be fixed. Trying again... (tries %1/%2)").arg(tries).arg(max_tries));
 				model->validateRelationships();
 				objs_xml = fail_objs;
-				objs_xml.append(constr);
 				fail_objs.clear();
-				constr.clear();
 			}
 		}
 	}
@@ -1769,8 +2273,19 @@ void PgModelerCliApp::loadModel()
 	//Create the systems objects on model before loading it
 	model->createSystemObjects(false);
 
+	QStringList load_filters;
+
+	/* When exporting or running a partial diff using object filters only the matching objects and
+	 * their dependencies are loaded. The filters created from the changelog (partial diff by date) depend
+	 * on the model itself so in that case the whole model is loaded */
+	if(!obj_filters.isEmpty() &&
+		 (!parsed_opts.count(Diff) ||
+			(parsed_opts.count(PartialDiff) && !start_date.isValid() && !end_date.isValid())))
+		load_filters = obj_filters;
+
 	//Load the model file
-	model->loadModel(parsed_opts[Input]);
+	model->loadModel(parsed_opts[Input], load_filters,
+									 parsed_opts.count(MatchByName) ? Attributes::Name : Attributes::Signature);
 
 	/* The scene object is created only when some options are used
 	 * so we need to check it if is not null to avoid segfaults */
@@ -1832,7 +2347,8 @@ void PgModelerCliApp::exportModel()
 			printMessage(tr("Export to output directory: %1").arg(parsed_opts[Output]));
 
 		export_hlp->exportToSQL(model, parsed_opts[Output], parsed_opts[PgSqlVer],
-														parsed_opts.count(Split) > 0, code_gen_option);
+														parsed_opts.count(Split) > 0, code_gen_option,
+														parsed_opts.count(Incremental) > 0);
 	}
 	//Export data dictionary
 	else if(parsed_opts.count(ExportToDict))
@@ -1890,7 +2406,10 @@ void PgModelerCliApp::importDatabase(DatabaseModel *model, Connection conn)
 		QString db_oid;
 		QStringList force_tab_objs;
 		bool imp_sys_objs = (parsed_opts.count(ImportSystemObjs) > 0),
-				imp_ext_objs = (parsed_opts.count(ImportExtensionObjs) > 0);
+				imp_ext_objs = (parsed_opts.count(ImportExtensionObjs) > 0),
+
+				// Catalog snapshots are imported in the same way as the database compared in the diff
+				diff_import = (parsed_opts.count(Diff) > 0 || parsed_opts.count(CreateSnapshot) > 0);
 
 		if(parsed_opts[ForceChildren] == AllChildren)
 		{
@@ -1927,7 +2446,7 @@ void PgModelerCliApp::importDatabase(DatabaseModel *model, Connection conn)
 																 true,
 																 parsed_opts.count(IgnoreImportErrors) > 0,
 																 parsed_opts.count(DebugMode) > 0,
-																 !parsed_opts.count(Diff), !parsed_opts.count(Diff));
+																 !diff_import, !diff_import);
 
 		model->createSystemObjects(true);
 		import_hlp->setSelectedOIDs(model, obj_oids, col_oids);
@@ -1940,10 +2459,114 @@ void PgModelerCliApp::importDatabase(DatabaseModel *model, Connection conn)
 	}
 }
 
+void PgModelerCliApp::createSnapshot()
+{
+	DatabaseModel *snap_model = new DatabaseModel;
+	QByteArray buffer;
+	QString pgsql_ver;
+	QFile output;
+
+	printMessage(tr("Starting catalog snapshot creation..."));
+	printMessage(tr("Input database: %1").arg(connection.getConnectionId(true, true)));
+
+	try
+	{
+		importDatabase(snap_model, connection);
+
+		connection.connect();
+		pgsql_ver = connection.getPgSQLVersion(true);
+		connection.close();
+
+		printMessage(tr("Saving the catalog snapshot to file..."));
+		buffer = snap_model->getSourceCode(SchemaParser::XmlCode).toUtf8();
+
+		/* The snapshot file stores a small header identifying the source server and the
+		 * moment of the capture followed by the compressed XML code of the imported model */
+		output.setFileName(parsed_opts[Output]);
+
+		if(!output.open(QFile::WriteOnly | QFile::Truncate))
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(parsed_opts[Output]),
+											ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		QDataStream stream(&output);
+		stream.setVersion(QDataStream::Qt_6_0);
+		stream << SnapshotHeader << GlobalAttributes::PgModelerVersion << pgsql_ver
+					 << connection.getConnectionParam(Connection::ParamDbName)
+					 << QDateTime::currentDateTime() << qCompress(buffer);
+		output.close();
+
+		if(stream.status() != QDataStream::Ok)
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(parsed_opts[Output]),
+											ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		delete snap_model;
+	}
+	catch(Exception &e)
+	{
+		delete snap_model;
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+
+	printMessage(tr("Catalog snapshot successfully created!\n"));
+}
+
+QString PgModelerCliApp::loadSnapshot(DatabaseModel *model, const QString &filename)
+{
+	QFile input;
+	QTemporaryFile model_file;
+	QString header, pgmodeler_ver, pgsql_ver, dbname;
+	QDateTime created_at;
+	QByteArray buffer;
+
+	input.setFileName(filename);
+
+	if(!input.open(QFile::ReadOnly))
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(filename),
+										ErrorCode::FileDirectoryNotAccessed,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	QDataStream stream(&input);
+	stream.setVersion(QDataStream::Qt_6_0);
+	stream >> header;
+
+	if(header != SnapshotHeader)
+		throw Exception(tr("The file `%1' is not a valid catalog snapshot!").arg(filename), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	stream >> pgmodeler_ver >> pgsql_ver >> dbname >> created_at >> buffer;
+	input.close();
+	buffer = qUncompress(buffer);
+
+	if(stream.status() != QDataStream::Ok || buffer.isEmpty())
+		throw Exception(tr("The catalog snapshot `%1' is corrupted!").arg(filename), ErrorCode::Custom,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	printMessage(tr("Snapshot of the database `%1' (PostgreSQL %2) created at %3.")
+							 .arg(dbname, pgsql_ver, created_at.toString(Qt::ISODate)));
+
+	try
+	{
+		/* The model is loaded through a temporary file since the model loading
+		 * depends on the XML parser's file loading to validate the code against the DTDs */
+		model_file.setFileTemplate(GlobalAttributes::getTemporaryFilePath("snapshot_XXXXXX") + GlobalAttributes::DbModelExt);
+
+		if(!model_file.open() || model_file.write(buffer) != buffer.size())
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(model_file.fileName()),
+											ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		model_file.close();
+		model->createSystemObjects(false);
+		model->loadModel(model_file.fileName());
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+
+	return pgsql_ver;
+}
+
 void PgModelerCliApp::diffModelDatabase()
 {
 	DatabaseModel *model_aux = new DatabaseModel();
-	QString dbname;
+	QString dbname, snapshot_ver;
 	std::vector<BaseObject *> filtered_objs;
 
 	printMessage(tr("Starting diff process..."));
@@ -1953,7 +2576,11 @@ void PgModelerCliApp::diffModelDatabase()
 	else
 		printMessage(tr("Input database: %1").arg(connection.getConnectionId(true, true)));
 
-	dbname = extra_connection.getConnectionId(true, true);
+	if(parsed_opts.count(CompareToSnapshot))
+		dbname = parsed_opts[CompareToSnapshot];
+	else
+		dbname = extra_connection.getConnectionId(true, true);
+
 	printMessage(tr("Compare to: %1").arg(dbname));
 
 	if(!parsed_opts[Input].isEmpty())
@@ -2005,8 +2632,16 @@ void PgModelerCliApp::diffModelDatabase()
 		importDatabase(model, connection);
 	}
 
-	printMessage(tr("Importing the database `%1'...").arg(dbname));
-	importDatabase(model_aux, extra_connection);
+	if(parsed_opts.count(CompareToSnapshot))
+	{
+		printMessage(tr("Loading the catalog snapshot `%1'...").arg(dbname));
+		snapshot_ver = loadSnapshot(model_aux, dbname);
+	}
+	else
+	{
+		printMessage(tr("Importing the database `%1'...").arg(dbname));
+		importDatabase(model_aux, extra_connection);
+	}
 
 	diff_hlp->setModels(model, model_aux);
 	diff_hlp->setFilteredObjects(filtered_objs);
@@ -2020,8 +2655,13 @@ void PgModelerCliApp::diffModelDatabase()
 	diff_hlp->setDiffOption(ModelsDiffHelper::OptDontDropMissingObjs, !parsed_opts.count(DropMissingObjs));
 	diff_hlp->setDiffOption(ModelsDiffHelper::OptDropMissingColsConstr, !parsed_opts.count(ForceDropColsConstrs));
 
+	if(parsed_opts.count(DiffJobs))
+		diff_hlp->setDiffJobs(parsed_opts[DiffJobs].toUInt());
+
 	if(!parsed_opts[PgSqlVer].isEmpty())
 		diff_hlp->setPgSQLVersion(parsed_opts[PgSqlVer]);
+	else if(!snapshot_ver.isEmpty())
+		diff_hlp->setPgSQLVersion(snapshot_ver);
 	else
 	{
 		extra_connection.connect();
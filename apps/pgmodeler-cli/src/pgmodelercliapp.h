@@ -36,6 +36,7 @@
 #include "settings/generalconfigwidget.h"
 #include "settings/connectionsconfigwidget.h"
 #include "settings/relationshipconfigwidget.h"
+#include "settings/appearanceconfigwidget.h"
 #include "settings/generalconfigwidget.h"
 #include "tools/databaseimporthelper.h"
 #include "tools/modelsdiffhelper.h"
@@ -85,6 +86,9 @@ class PgModelerCliApp: public Application {
 
 		GeneralConfigWidget *general_conf;
 
+		//! \brief Appearance configuration widget used to load the objects' graphical settings
+		AppearanceConfigWidget *appearance_conf;
+
 		//! \brief Creates an standard out to handles QStrings
 		static QTextStream out;
 
@@ -167,6 +171,7 @@ class PgModelerCliApp: public Application {
 		SystemWide,
 		NoIndex,
 		Split,
+		Incremental,
 		OriginalSql,
 		DependenciesSql,
 		ChildrenSql,
@@ -198,10 +203,19 @@ class PgModelerCliApp: public Application {
 		NoCascadeDrop,
 		ForceRecreateObjs,
 		OnlyUnmodifiable,
+		CompareToSnapshot,
+		DiffJobs,
 
 		CreateConfigs,
 		MissingOnly,
 
+		CreateSnapshot,
+		SnapshotHeader,
+
+		Batch,
+		BatchJobs,
+		StdInput,
+
 		TagExpr,
 		EndTagExpr,
 		AttributeExpr,
@@ -232,6 +246,15 @@ class PgModelerCliApp: public Application {
 		//! \brief Recreates the objects from the obj_xml list fixing the creation order for them
 		void recreateObjects();
 
+		/*! \brief Extracts from the object's XML code the names in which the object can be referenced by others (obj_names)
+		 * and the names of the objects that it references (ref_names). All names are returned without quotes */
+		void extractXMLReferences(const QString &obj_xml, QStringList &obj_names, QStringList &ref_names);
+
+		/*! \brief Sorts the obj_xml list by placing each object after the ones it references (topological order).
+		 * Objects with circular references keep their original relative order. The foreign keys are extracted
+		 * from the tables and placed at the end of the list so the tables can be recreated without them */
+		void sortObjectsXML();
+
 		//! \brief Fix some xml attributes and remove unused tags
 		void fixObjectAttributes(QString &obj_xml);
 
@@ -259,6 +282,14 @@ class PgModelerCliApp: public Application {
 		void configureConnection(bool extra_conn);
 		void importDatabase(DatabaseModel *model, Connection conn);
 
+		/*! \brief Imports the input database and saves the resulting model in a compressed catalog snapshot file.
+		 * The snapshot can be used in place of the compared database in later diff operations */
+		void createSnapshot();
+
+		/*! \brief Loads the model stored in the provided catalog snapshot file returning
+		 * the PostgreSQL version of the server from which the snapshot was created */
+		QString loadSnapshot(DatabaseModel *model, const QString &filename);
+
 		/*! \brief Prints to the stdout the provided text appending a \n on the string
 		 * even if the silent mode is active. */
 		void printText(const QString &txt = "");
@@ -271,6 +302,30 @@ class PgModelerCliApp: public Application {
 		void createConfigurations();
 		void listConnections();
 
+		//! \brief Extracts the options and their values from the provided argument list (the first item is the program name)
+		attribs_map extractOptions(const QStringList &args);
+
+		//! \brief Creates the model, scene and connections needed by the operation described by the parsed options
+		void configureOperation();
+
+		/*! \brief Destroys the model, scene and helpers of the current operation and clears the parsed options.
+		 * The loaded configurations and connections are preserved so they can be reused by the next operation */
+		void resetOperation();
+
+		//! \brief Executes the operation mode described by the parsed options
+		void runOperation();
+
+		//! \brief Returns the jobs (command lines) stored in the batch file ignoring empty lines and comments
+		QStringList readBatchJobs(const QString &filename);
+
+		/*! \brief Runs all jobs in the batch file sequentially in the current process.
+		 * Returns -1 if at least one of the jobs failed */
+		int runBatch();
+
+		/*! \brief Distributes the jobs among the specified number of child processes
+		 * each one running its set of jobs in batch mode. Returns -1 if at least one of the jobs failed */
+		int runBatchParallel(const QStringList &jobs, unsigned batch_jobs);
+
 	public:
 		PgModelerCliApp(int argc, char **argv);
 		virtual ~PgModelerCliApp();
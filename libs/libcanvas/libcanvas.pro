@@ -23,7 +23,8 @@ HEADERS += src/canvasglobal.h \
             src/styledtextboxview.h \
 	    src/beziercurveitem.h \
 	    src/textpolygonitem.h \
-    src/attributestoggleritem.h
+    src/attributestoggleritem.h \
+    src/rectindex.h
 
 SOURCES +=  src/baseobjectview.cpp \
 	src/layeritem.cpp \
@@ -40,7 +41,8 @@ SOURCES +=  src/baseobjectview.cpp \
             src/styledtextboxview.cpp \
 	    src/beziercurveitem.cpp \
 	    src/textpolygonitem.cpp \
-    src/attributestoggleritem.cpp
+    src/attributestoggleritem.cpp \
+    src/rectindex.cpp
 
 unix|windows: LIBS += $$LIBCORE_LIB \
 		      $$LIBPARSERS_LIB \
@@ -341,6 +341,10 @@ void AttributesTogglerItem::paint(QPainter *painter, const QStyleOptionGraphicsI
 	QGraphicsItem *parent = this->parentItem();
 	RoundedRectItem::paint(painter, option, widget);
 
+	//The toggler buttons are drawn only in full detail
+	if(BaseObjectView::getLevelOfDetail(this, painter) != BaseObjectView::FullDetail)
+		return;
+
 	for(unsigned arr_id = 0; arr_id < 7; arr_id++)
 	{
 		if(!buttons[arr_id]->isVisible())
@@ -27,6 +27,8 @@ unsigned BaseObjectView::global_sel_order=1;
 bool BaseObjectView::use_placeholder=true;
 bool BaseObjectView::compact_view=false;
 bool BaseObjectView::hide_shadow=false;
+bool BaseObjectView::use_item_cache=false;
+double BaseObjectView::lod_zoom_factors[2]={ BaseObjectView::DefTitleOnlyZoom, BaseObjectView::DefBoxOnlyZoom };
 
 BaseObjectView::BaseObjectView(BaseObject *object)
 {
@@ -303,6 +305,64 @@ bool BaseObjectView::isShadowHidden()
 	return hide_shadow;
 }
 
+void BaseObjectView::setLevelOfDetailZoom(LevelOfDetail lod, double zoom)
+{
+	if(lod == FullDetail)
+		return;
+
+	lod_zoom_factors[lod - 1] = zoom < 0 ? 0 : zoom;
+}
+
+void BaseObjectView::setItemCacheEnabled(bool value)
+{
+	use_item_cache = value;
+
+	/* The default pixmap cache limit (10MB) holds only a few tables in device coordinates
+	 * causing the cached pixmaps to be discarded and repainted all the time */
+	if(use_item_cache && QPixmapCache::cacheLimit() < ItemCacheLimit)
+		QPixmapCache::setCacheLimit(ItemCacheLimit);
+}
+
+bool BaseObjectView::isItemCacheEnabled()
+{
+	return use_item_cache;
+}
+
+double BaseObjectView::getLevelOfDetailZoom(LevelOfDetail lod)
+{
+	if(lod == FullDetail)
+		return 0;
+
+	return lod_zoom_factors[lod - 1];
+}
+
+BaseObjectView::LevelOfDetail BaseObjectView::getLevelOfDetail(double zoom)
+{
+	if(zoom < lod_zoom_factors[BoxOnly - 1])
+		return BoxOnly;
+
+	if(zoom < lod_zoom_factors[TitleOnly - 1])
+		return TitleOnly;
+
+	return FullDetail;
+}
+
+BaseObjectView::LevelOfDetail BaseObjectView::getSceneLevelOfDetail()
+{
+	ObjectsScene *scene = dynamic_cast<ObjectsScene *>(this->scene());
+	return scene ? scene->getLevelOfDetail() : FullDetail;
+}
+
+BaseObjectView::LevelOfDetail BaseObjectView::getLevelOfDetail(const QGraphicsItem *item, const QPainter *painter)
+{
+	ObjectsScene *scene = item ? dynamic_cast<ObjectsScene *>(item->scene()) : nullptr;
+
+	if(!painter || !scene || scene->getLevelOfDetail() == FullDetail)
+		return FullDetail;
+
+	return getLevelOfDetail(QStyleOptionGraphicsItem::levelOfDetailFromTransform(painter->worldTransform()));
+}
+
 QVariant BaseObjectView::itemChange(GraphicsItemChange change, const QVariant &value)
 {
 	if(change==ItemPositionHasChanged)
@@ -317,6 +377,12 @@ QVariant BaseObjectView::itemChange(GraphicsItemChange change, const QVariant &v
 			graph_obj->setPosition(this->scenePos());
 			this->configurePositionInfo(this->pos());
 		}
+
+		// Keeping the rect of the object in its schema's index up to date
+		ObjectsScene *scene = dynamic_cast<ObjectsScene *>(this->scene());
+
+		if(scene)
+			scene->updateSchemaIndex(this);
 	}
 	else if(change == ItemSelectedHasChanged && obj_selection)
 	{
@@ -499,6 +565,46 @@ void BaseObjectView::__configureObject()
 						 ") " + QString("\nId: %1").arg(graph_obj->getObjectId()));
 		this->configurePositionInfo(graph_obj->getPosition());
 		this->configureProtectedIcon();
+		this->configureItemCache();
+
+		ObjectsScene *scene = dynamic_cast<ObjectsScene *>(this->scene());
+
+		if(scene)
+			scene->updateSchemaIndex(this);
+	}
+}
+
+void BaseObjectView::configureItemCache()
+{
+	ObjectsScene *scene = dynamic_cast<ObjectsScene *>(this->scene());
+	QGraphicsItem::CacheMode cache_mode = QGraphicsItem::NoCache;
+	QList<QGraphicsItem *> items = this->childItems();
+	QGraphicsItem *item = nullptr;
+	bool enable_cache = use_item_cache && (!scene || scene->isObjectsCacheEnabled());
+
+	while(!items.isEmpty())
+	{
+		item = items.takeLast();
+
+		//The position info changes on every movement so there's no gain in caching it
+		if(item == pos_info_item)
+			continue;
+
+		/* Huge elements (e.g. the box of a schema with lots of tables) are painted directly
+		 * since their pixmaps would be too large to be kept in the pixmap cache */
+		if(enable_cache && item->boundingRect().width() <= ItemCacheMaxSize &&
+			 item->boundingRect().height() <= ItemCacheMaxSize)
+			cache_mode = QGraphicsItem::DeviceCoordinateCache;
+		else
+			cache_mode = QGraphicsItem::NoCache;
+
+		//Changing the cache mode discards the current cache, otherwise we need to invalidate it
+		if(item->cacheMode() != cache_mode)
+			item->setCacheMode(cache_mode);
+		else if(cache_mode != QGraphicsItem::NoCache)
+			item->update();
+
+		items.append(item->childItems());
 	}
 }
 
@@ -33,6 +33,16 @@
 #include "textpolygonitem.h"
 
 class __libcanvas BaseObjectView: public QObject, public QGraphicsItemGroup {
+	public:
+		/*! \brief Levels of detail in which the objects are rendered depending on the zoom applied to the canvas.
+		 * In TitleOnly tables/views have only their titles drawn and relationships are drawn without descriptors,
+		 * labels and attributes. In BoxOnly tables/views are drawn as plain boxes and relationships as straight lines */
+		enum LevelOfDetail: unsigned {
+			FullDetail,
+			TitleOnly,
+			BoxOnly
+		};
+
 	private:
 		Q_OBJECT
 
@@ -55,6 +65,15 @@ class __libcanvas BaseObjectView: public QObject, public QGraphicsItemGroup {
 		//! \brief Indicate if the graphical element representing object's shadow must be hidden.
 		static bool hide_shadow;
 
+		/*! \brief Stores the zoom factors below which the objects are rendered in TitleOnly and BoxOnly levels of detail.
+		 * A zero zoom factor disables the related level of detail */
+		static double lod_zoom_factors[2];
+
+		/*! \brief Indicates if the graphical elements of the objects must be rendered via QGraphicsItem::DeviceCoordinateCache.
+		 * When enabled, the static objects (tables, views, textboxes and schemas) are painted once into off-screen pixmaps
+		 * which are reused while scrolling/panning the canvas until the object is reconfigured or the zoom changes */
+		static bool use_item_cache;
+
 		/*! \brief Stores the selection order of the current object. This attribute is used to
 		 know when an item was selected before another in the scene because the implementation of
 		 the method QGraphicsScene :: selectedItem() the selected objects are returned without
@@ -106,6 +125,11 @@ class __libcanvas BaseObjectView: public QObject, public QGraphicsItemGroup {
 
 		void configurePlaceholder();
 
+		/*! \brief Applies the item cache mode (see setItemCacheEnabled) to the graphical elements of the object,
+		 * invalidating the cached pixmaps of the elements when the cache is already in use. The cache is not used
+		 * when the object's scene has the objects cache disabled (see ObjectsScene::setObjectsCacheEnabled) */
+		void configureItemCache();
+
 		void mousePressEvent(QGraphicsSceneMouseEvent *event);
 
 		void setSelectionOrder(bool selected);
@@ -122,6 +146,9 @@ class __libcanvas BaseObjectView: public QObject, public QGraphicsItemGroup {
 		//! \brief Clear all the ids and moves the object to default layer (0)
 		void resetLayers();
 
+		//! \brief Returns the level of detail of the scene in which the object is (FullDetail if it isn't in an ObjectsScene)
+		LevelOfDetail getSceneLevelOfDetail();
+
 	public:
 		static constexpr double VertSpacing=2.0,
 		HorizSpacing=2.0,
@@ -129,10 +156,18 @@ class __libcanvas BaseObjectView: public QObject, public QGraphicsItemGroup {
 		ObjectBorderWidth=1.00,
 		MaxDpiFactor=1.4,
 		ObjectShadowXPos=8,
-		ObjectShadowYPos=8;
+		ObjectShadowYPos=8,
+		DefTitleOnlyZoom=0.40,
+		DefBoxOnlyZoom=0.20;
 
 		static constexpr int ObjectAlphaChannel=128,
-		ObjectShadowAlphaChannel=50;
+		ObjectShadowAlphaChannel=50,
+
+		//! \brief Minimum size (in KB) of the pixmap cache when the objects are rendered using item cache
+		ItemCacheLimit=262144,
+
+		//! \brief Maximum width/height of the graphical elements rendered using item cache
+		ItemCacheMaxSize=2048;
 
 		BaseObjectView(BaseObject *object=nullptr);
 		virtual ~BaseObjectView();
@@ -174,6 +209,27 @@ class __libcanvas BaseObjectView: public QObject, public QGraphicsItemGroup {
 
 		static bool isShadowHidden();
 
+		/*! \brief Enables the rendering of the objects via item cache. This affects only the objects
+		 * configured after calling this method. When enabled, the pixmap cache limit is raised to ItemCacheLimit */
+		static void setItemCacheEnabled(bool value);
+
+		static bool isItemCacheEnabled();
+
+		//! \brief Defines the zoom factor below which the objects are rendered in the provided level of detail (TitleOnly or BoxOnly)
+		static void setLevelOfDetailZoom(LevelOfDetail lod, double zoom);
+
+		//! \brief Returns the zoom factor below which the objects are rendered in the provided level of detail
+		static double getLevelOfDetailZoom(LevelOfDetail lod);
+
+		//! \brief Returns the level of detail in which the objects must be rendered in the provided zoom factor
+		static LevelOfDetail getLevelOfDetail(double zoom);
+
+		/*! \brief Returns the level of detail in which the item must be painted by the provided painter.
+		 * Reduced levels of detail are only used when the item's scene is not being rendered in full detail
+		 * (see ObjectsScene::setLevelOfDetail) and the painter's scale is below the configured zoom factors.
+		 * This way, the same item is painted in full detail in magnifier, printing and export operations */
+		static LevelOfDetail getLevelOfDetail(const QGraphicsItem *item, const QPainter *painter);
+
 		//! \brief Sets the  font style for the specified element id
 		static void setFontStyle(const QString &id, QTextCharFormat font_fmt);
 
@@ -133,8 +133,9 @@ QVariant BaseTableView::itemChange(GraphicsItemChange change, const QVariant &va
 	{
 		if(value.toBool() && pending_geom_update)
 		{
-			this->configureObject();
+			//The flag is cleared first since the update can be deferred again (see isGeometryUpdateDeferred())
 			pending_geom_update = false;
+			this->configureObject();
 		}
 	}
 	else if(change == ItemZValueHasChanged)
@@ -498,6 +499,20 @@ void BaseTableView::togglePlaceholder(bool value)
 	BaseObjectView::togglePlaceholder(!connected_rels.empty() && value);
 }
 
+bool BaseTableView::isGeometryUpdateDeferred()
+{
+	return !bounding_rect.isEmpty() && getSceneLevelOfDetail() != FullDetail;
+}
+
+void BaseTableView::updatePendingGeometry()
+{
+	if(!pending_geom_update || !this->isVisible())
+		return;
+
+	pending_geom_update = false;
+	this->configureObject();
+}
+
 void BaseTableView::configureObjectShadow()
 {
 	RoundedRectItem *rect_item=dynamic_cast<RoundedRectItem *>(obj_shadow);
@@ -53,7 +53,9 @@ class __libcanvas BaseTableView: public BaseObjectView {
 		/*! \brief This attributes indicates that the object's geometry update is pending demanding a
 		 * call to configureObject(). This attribute is set to true only when the objects is invisible
 		 * the the configureObject is called. Once the object gets visible again this attribute is set
-		 * to false and the geometry updated immediately (see BaseTableView::itemChange()) */
+		 * to false and the geometry updated immediately (see BaseTableView::itemChange()).
+		 * This attribute is also set when the geometry update is deferred due to a reduced level of detail
+		 * in the scene (see isGeometryUpdateDeferred()) */
 		bool pending_geom_update;
 
 		//! \brief Item groups that stores columns and extended attributes, respectively
@@ -124,6 +126,11 @@ class __libcanvas BaseTableView: public BaseObjectView {
 		 * to be displayed in the current page. See configureObject() on TableView and GraphicalView */
 		bool configurePaginationParams(BaseTable::TableSection page_id, unsigned total_attrs, unsigned &start_attr, unsigned &end_attr);
 
+		/*! \brief Returns true when the geometry update of the object must be postponed because the scene is rendered
+		 * in a reduced level of detail, in which the children objects aren't drawn. This only happens to objects already
+		 * configured at least once, so new objects are always displayed with their current geometry */
+		bool isGeometryUpdateDeferred();
+
 	public:
 		enum ConnectionPoint: unsigned {
 			LeftConnPoint,
@@ -169,6 +176,10 @@ class __libcanvas BaseTableView: public BaseObjectView {
 		//! \brief Configures the shadow for the table
 		void configureObjectShadow();
 
+		/*! \brief Updates the object's geometry if its update is pending. This method is called by the scene
+		 * when it's rendered in full detail again (see ObjectsScene::setLevelOfDetail()) */
+		void updatePendingGeometry();
+
 		//! \brief Returns a list of selected children objects
 		QList<TableObjectView *> getSelectedChidren();
 
@@ -21,15 +21,30 @@
 
 LayerItem::LayerItem(QGraphicsItem *parent) : QGraphicsPathItem(parent)
 {
+	// Needed so the exposed rect is available in paint() and only the visible texts are drawn
+	setFlag(QGraphicsItem::ItemUsesExtendedStyleOption, true);
+}
+
+void LayerItem::setObjectRect(QGraphicsItem *object, const QRectF &rect)
+{
+	rects_idx.setRect(object, rect);
+}
 
+bool LayerItem::removeObjectRect(QGraphicsItem *object)
+{
+	return rects_idx.removeRect(object);
+}
+
+void LayerItem::clearRects()
+{
+	rects_idx.clear();
 }
 
-void LayerItem::setRects(const QList<QRectF> &rects)
+void LayerItem::updatePath()
 {
 	QPainterPath path;
-	layer_rects = rects;
 
-	for(auto &rect : rects)
+	for(auto &rect : rects_idx.getRects())
 		path.addRoundedRect(rect, 10, 10);
 
 	path.setFillRule(Qt::WindingFill);
@@ -76,7 +91,7 @@ void LayerItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
 	painter->setPen(txt_color);
 	painter->setBrush(txt_color);
 
-	for(auto &brect : layer_rects)
+	for(auto &brect : rects_idx.getRects(option->exposedRect))
 	{
 		if(text_align == Qt::AlignLeft)
 			pnt.setX(brect.left() + LayerPadding);
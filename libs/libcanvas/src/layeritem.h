@@ -26,6 +26,7 @@
 #define LAYER_ITEM_H
 
 #include "canvasglobal.h"
+#include "rectindex.h"
 #include <QGraphicsPathItem>
 #include <QPainter>
 #include <QStyleOptionGraphicsItem>
@@ -35,8 +36,9 @@ class __libcanvas LayerItem : public QGraphicsPathItem {
 		//! \brief Stores the text color of the item
 		QColor txt_color;
 
-		//! \brief Stores the rects used to generate the path that represents the layer
-		QList<QRectF> layer_rects;
+		/*! \brief Stores per object the rects used to generate the path that represents the layer.
+		 * The index is also used to paint the texts only of the rects exposed in the viewport */
+		RectIndex rects_idx;
 
 		/*! \brief Stores the text alignment of the layer. The always displayed at the top
 		 * of the rectagles but can be aligned to left or right */
@@ -47,7 +49,7 @@ class __libcanvas LayerItem : public QGraphicsPathItem {
 
 		/*! \brief Forcing the non-usage of the setPath method in this class.
 		 * For the correct configuration of a LayerPathItem instance, use
-		 * setRects() instead */
+		 * setObjectRect()/updatePath() instead */
 		void setPath(const QPainterPath &) = delete;
 
 	public:
@@ -55,11 +57,20 @@ class __libcanvas LayerItem : public QGraphicsPathItem {
 
 		LayerItem(QGraphicsItem *parent = nullptr);
 
+		/*! \brief Stores (or replaces) the rect of the provided object in the layer.
+		 * The rectangle must come already with its desired dimensions configured.
+		 * The path of the layer is only changed after calling updatePath() */
+		void setObjectRect(QGraphicsItem *object, const QRectF &rect);
+
+		//! \brief Removes the rect of the provided object returning true when the object had a rect in the layer
+		bool removeObjectRect(QGraphicsItem *object);
+
+		//! \brief Removes all the rects of the layer
+		void clearRects();
+
 		/*! \brief Configures the layer item by generating an internal
-		 * QPainterPath that is composed by the rects in the list.
-		 * The rectangles must come already with their desired dimensions configured.
-		 * This method will keep untouched the rects */
-		void setRects(const QList<QRectF> &rects);
+		 * QPainterPath that is composed by the rects of the objects in the layer */
+		void updatePath();
 
 		//! \brief Defines the layer text alignment (Only Qt::AlignLeft and Qt::AlignRight are accepted)
 		void setTextAlignment(Qt::Alignment align);
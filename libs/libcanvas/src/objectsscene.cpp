@@ -46,6 +46,8 @@ ObjectsScene::ObjectsScene()
 	is_layer_rects_visible=is_layer_names_visible=false;
 	moving_objs=move_scene=false;
 	show_scene_limits=enable_range_sel=true;
+	curr_lod=BaseObjectView::FullDetail;
+	objs_cache_enabled=true;
 
 	sel_ini_pnt.setX(DNaN);
 	sel_ini_pnt.setY(DNaN);
@@ -79,6 +81,10 @@ ObjectsScene::ObjectsScene()
 	scene_move_timer.setInterval(SceneMoveTimeout);
 	corner_hover_timer.setInterval(SceneMoveTimeout * 10);
 	object_move_timer.setInterval(SceneMoveTimeout * 10);
+
+	rels_update_timer.setSingleShot(true);
+	rels_update_timer.setInterval(RelsUpdateTimeout);
+	connect(&rels_update_timer, &QTimer::timeout, this, &ObjectsScene::updatePendingRelationships);
 }
 
 ObjectsScene::~ObjectsScene()
@@ -373,59 +379,32 @@ void ObjectsScene::setActiveLayers(QList<unsigned> layers_idxs)
 
 void ObjectsScene::updateLayerRects()
 {
+	/* The rects of the schemas' children depend on the visible layers
+	 * so they need to be recalculated in the schemas indexes */
+	for(auto &itr : indexed_schemas)
+		schemas_idx[itr.second].setRect(itr.first, getSchemaChildRect(itr.first));
+
 	if(layers_paths.isEmpty())
 		return;
 
 	for(auto &path : layers_paths)
+	{
+		path->clearRects();
 		path->setVisible(false);
+	}
 
 	if(!is_layer_rects_visible)
 		return;
 
 	int idx = 0, act_layer_idx = 0;
 	BaseObjectView *obj_view = nullptr;
-	ObjectType obj_type;
-	QRectF brect;
-	QMap<int, QList<QRectF>> rects;
-	QFontMetricsF fm(LayerItem::getDefaultFont());
 
 	for(auto &item : this->items())
 	{
 		obj_view = dynamic_cast<BaseObjectView *>(item);
 
 		if(obj_view && !obj_view->parentItem())
-		{
-			obj_type = 	obj_view->getUnderlyingObject()->getObjectType();
-
-			/* Schemas and relationship are ignored when determining the paths for the layers
-			 * because since these objects can have big bounding rects it may polute. For now
-			 * only table-like objects and textboxes can display layer boxes. */
-			if(obj_type == ObjectType::Schema ||
-				 obj_type ==ObjectType::BaseRelationship ||
-				 obj_type ==ObjectType::Relationship)
-				continue;
-
-			brect = obj_view->boundingRect();
-			brect.moveTo(obj_view->pos());
-
-			for(auto &layer_id : obj_view->getLayers())
-			{
-				if(static_cast<int>(layer_id) >= layers.size() ||
-					 !active_layers.contains(layers.at(layer_id)))
-					continue;
-
-				/* We need to adjust the bounding rect dimension in such a way
-				 * to take into account the font height (if the layer names are visible)
-				 * as well as a default padding so the rectangles doesn't have the same size
-				 * of the object's bounding rect */
-				brect.adjust(-LayerItem::LayerPadding,
-										 (is_layer_names_visible ? -fm.height() : -LayerItem::LayerPadding),
-										 LayerItem::LayerPadding,
-										 LayerItem::LayerPadding);
-
-				rects[layer_id].append(brect);
-			}
-		}
+			storeLayerRects(obj_view);
 	}
 
 	//Based the active layers we reconfigure the graphical items of each layer
@@ -434,12 +413,182 @@ void ObjectsScene::updateLayerRects()
 		idx = layers.indexOf(layer_name);
 		layers_paths[idx]->setTextAlignment(act_layer_idx % 2 == 0 ? Qt::AlignLeft : Qt::AlignRight);
 		layers_paths[idx]->setText(is_layer_names_visible ? layer_name : "");
-		layers_paths[idx]->setRects(rects[idx]);
+		layers_paths[idx]->updatePath();
 		layers_paths[idx]->setVisible(true);
 		act_layer_idx++;
 	}
 }
 
+void ObjectsScene::updateLayerRects(const QList<BaseObjectView *> &objs)
+{
+	// The objects may have changed the layers they are in, so their rects in the schemas are updated as well
+	for(auto &obj_view : objs)
+		updateSchemaIndex(obj_view);
+
+	if(layers_paths.isEmpty() || !is_layer_rects_visible)
+		return;
+
+	QList<unsigned> upd_layers;
+
+	for(auto &obj_view : objs)
+	{
+		// Removing the object's current rects so they can be recalculated
+		for(unsigned layer_id = 0; layer_id < static_cast<unsigned>(layers_paths.size()); layer_id++)
+		{
+			if(layers_paths[layer_id]->removeObjectRect(obj_view) && !upd_layers.contains(layer_id))
+				upd_layers.append(layer_id);
+		}
+
+		// Objects removed from the scene have only their rects removed from the layers
+		if(obj_view->scene() != this || obj_view->parentItem())
+			continue;
+
+		for(auto &layer_id : storeLayerRects(obj_view))
+		{
+			if(!upd_layers.contains(layer_id))
+				upd_layers.append(layer_id);
+		}
+	}
+
+	for(auto &layer_id : upd_layers)
+	{
+		if(static_cast<int>(layer_id) < layers_paths.size())
+			layers_paths[layer_id]->updatePath();
+	}
+}
+
+QList<unsigned> ObjectsScene::storeLayerRects(BaseObjectView *obj_view)
+{
+	QList<unsigned> layer_ids;
+
+	if(!obj_view || !obj_view->getUnderlyingObject())
+		return layer_ids;
+
+	ObjectType obj_type = obj_view->getUnderlyingObject()->getObjectType();
+
+	/* Schemas and relationship are ignored when determining the paths for the layers
+	 * because since these objects can have big bounding rects it may polute. For now
+	 * only table-like objects and textboxes can display layer boxes. */
+	if(obj_type == ObjectType::Schema ||
+		 obj_type ==ObjectType::BaseRelationship ||
+		 obj_type ==ObjectType::Relationship)
+		return layer_ids;
+
+	QRectF brect;
+	QFontMetricsF fm(LayerItem::getDefaultFont());
+
+	brect = obj_view->boundingRect();
+	brect.moveTo(obj_view->pos());
+
+	for(auto &layer_id : obj_view->getLayers())
+	{
+		if(static_cast<int>(layer_id) >= layers.size() ||
+			 !active_layers.contains(layers.at(layer_id)))
+			continue;
+
+		/* We need to adjust the bounding rect dimension in such a way
+		 * to take into account the font height (if the layer names are visible)
+		 * as well as a default padding so the rectangles doesn't have the same size
+		 * of the object's bounding rect */
+		brect.adjust(-LayerItem::LayerPadding,
+								 (is_layer_names_visible ? -fm.height() : -LayerItem::LayerPadding),
+								 LayerItem::LayerPadding,
+								 LayerItem::LayerPadding);
+
+		layers_paths[layer_id]->setObjectRect(obj_view, brect);
+		layer_ids.append(layer_id);
+	}
+
+	return layer_ids;
+}
+
+QRectF ObjectsScene::getSchemaChildRect(BaseObjectView *obj_view)
+{
+	QRectF rect;
+	double size_inc = 0, left_inc = 0, top_inc = 0;
+
+	if(is_layer_rects_visible)
+	{
+		int num_layers = 0;
+
+		/* Determining the amount of visible layers of the object
+		 * in order to generated the correct bounding rect dimension */
+		for(auto &layer_id : obj_view->getLayers())
+		{
+			if(static_cast<int>(layer_id) < layers.size() &&
+				 active_layers.contains(layers.at(layer_id)))
+				num_layers++;
+		}
+
+		size_inc = left_inc = top_inc = LayerItem::LayerPadding * num_layers;
+
+		if(is_layer_names_visible)
+			top_inc = QFontMetricsF(LayerItem::getDefaultFont()).height() * num_layers;
+	}
+
+	rect.setTopLeft(obj_view->pos() - QPointF(left_inc, top_inc));
+	rect.setSize(obj_view->boundingRect().size() + QSizeF(2 * size_inc, size_inc + top_inc));
+
+	return rect;
+}
+
+void ObjectsScene::updateSchemaIndex(BaseObjectView *obj_view)
+{
+	if(!obj_view || !obj_view->getUnderlyingObject() ||
+		 !BaseTable::isBaseTable(obj_view->getUnderlyingObject()->getObjectType()))
+		return;
+
+	BaseObject *schema = nullptr, *prev_schema = nullptr;
+	auto itr = indexed_schemas.find(obj_view);
+
+	if(itr != indexed_schemas.end())
+		prev_schema = itr->second;
+
+	if(obj_view->scene() == this && !obj_view->parentItem())
+		schema = obj_view->getUnderlyingObject()->getSchema();
+
+	// The object left its previous schema (or the scene) so its rect is removed from that schema's index
+	if(prev_schema && prev_schema != schema)
+	{
+		schemas_idx[prev_schema].removeRect(obj_view);
+
+		if(schemas_idx[prev_schema].isEmpty())
+			schemas_idx.erase(prev_schema);
+
+		indexed_schemas.erase(itr);
+	}
+
+	if(schema)
+	{
+		schemas_idx[schema].setRect(obj_view, getSchemaChildRect(obj_view));
+		indexed_schemas[obj_view] = schema;
+	}
+}
+
+QRectF ObjectsScene::getSchemaChildrenRect(BaseObject *schema)
+{
+	auto itr = schemas_idx.find(schema);
+
+	if(itr == schemas_idx.end())
+		return QRectF();
+
+	return itr->second.getBoundingRect();
+}
+
+QList<BaseObjectView *> ObjectsScene::getSchemaChildren(BaseObject *schema)
+{
+	QList<BaseObjectView *> children;
+	auto itr = schemas_idx.find(schema);
+
+	if(itr == schemas_idx.end())
+		return children;
+
+	for(auto &item : itr->second.getItems())
+		children.append(dynamic_cast<BaseObjectView *>(item));
+
+	return children;
+}
+
 void ObjectsScene::setLayerRectsVisible(bool value)
 {
 	is_layer_rects_visible = value;
@@ -609,6 +758,109 @@ void ObjectsScene::setShowSceneLimits(bool show)
 	show_scene_limits = show;
 }
 
+void ObjectsScene::setLevelOfDetail(BaseObjectView::LevelOfDetail lod)
+{
+	if(curr_lod == lod)
+		return;
+
+	RelationshipView *rel_view = nullptr;
+	BaseTableView *tab_view = nullptr;
+	QList<QGraphicsItem *> items = this->items();
+
+	curr_lod = lod;
+
+	/* The tables which geometry updates were deferred in the reduced level of detail
+	 * are updated prior to the relationships so these ones can be connected correctly */
+	if(curr_lod == BaseObjectView::FullDetail)
+	{
+		for(auto &item : items)
+		{
+			tab_view = dynamic_cast<BaseTableView *>(item);
+
+			if(tab_view)
+				tab_view->updatePendingGeometry();
+		}
+	}
+
+	for(auto &item : items)
+	{
+		rel_view = dynamic_cast<RelationshipView *>(item);
+
+		if(rel_view)
+			rel_view->configureLine();
+		/* The cached pixmaps of the objects were rendered in the previous level of detail
+		 * so we need to invalidate them */
+		else if(item->cacheMode() != QGraphicsItem::NoCache)
+			item->update();
+	}
+
+	this->update();
+}
+
+BaseObjectView::LevelOfDetail ObjectsScene::getLevelOfDetail()
+{
+	return curr_lod;
+}
+
+void ObjectsScene::setObjectsCacheEnabled(bool enable)
+{
+	if(objs_cache_enabled == enable)
+		return;
+
+	BaseObjectView *obj_view = nullptr;
+
+	objs_cache_enabled = enable;
+
+	if(!BaseObjectView::isItemCacheEnabled())
+		return;
+
+	for(auto &item : this->items())
+	{
+		obj_view = dynamic_cast<BaseObjectView *>(item);
+
+		//Relationships aren't rendered via item cache (see BaseObjectView::__configureObject)
+		if(obj_view && !dynamic_cast<RelationshipView *>(item))
+			obj_view->configureItemCache();
+	}
+}
+
+bool ObjectsScene::isObjectsCacheEnabled()
+{
+	return objs_cache_enabled;
+}
+
+void ObjectsScene::scheduleRelationshipUpdate(RelationshipView *rel)
+{
+	if(!rel)
+		return;
+
+	pending_rels.insert(rel);
+
+	if(!rels_update_timer.isActive())
+		rels_update_timer.start();
+}
+
+void ObjectsScene::cancelRelationshipUpdate(RelationshipView *rel)
+{
+	pending_rels.remove(rel);
+}
+
+void ObjectsScene::updatePendingRelationships()
+{
+	QSet<RelationshipView *> rels;
+
+	/* Reconfiguring a relationship may cause others to be scheduled again
+	 * so we work on a copy of the pending list */
+	rels.swap(pending_rels);
+	rels_update_timer.stop();
+
+	for(auto &rel : rels)
+	{
+		if(rel->scene() == this)
+			rel->configureLine();
+	}
+}
+
 void ObjectsScene::setLockDelimiterScale(bool lock, double curr_scale)
 {
 	if(lock && curr_scale > 0 && curr_scale < 1)
@@ -667,9 +919,13 @@ QRectF ObjectsScene::itemsBoundingRect(bool seek_only_db_objs, bool selected_onl
 		return QGraphicsScene::itemsBoundingRect();
 	else
 	{
-		QRectF rect=QGraphicsScene::itemsBoundingRect();
+		/* When handling only the selected items there's no need to calculate the bounding rect of the whole scene
+		 * (which visits all items) since it's used only as the initial value of the top-left point */
+		QRectF rect=(selected_only ? QRectF() : QGraphicsScene::itemsBoundingRect());
 		QList<QGraphicsItem *> items= (selected_only ? this->selectedItems() : this->items());
-		double x=rect.width(), y=rect.height(), x2 = -10000, y2 = -10000;
+		double x=(selected_only ? std::numeric_limits<double>::max() : rect.width()),
+				y=(selected_only ? std::numeric_limits<double>::max() : rect.height()),
+				x2 = -10000, y2 = -10000;
 		BaseObjectView *obj_view=nullptr;
 		QPointF pnt;
 		BaseGraphicObject *graph_obj=nullptr;
@@ -741,6 +997,46 @@ QRectF ObjectsScene::itemsBoundingRect(bool seek_only_db_objs, bool selected_onl
 	}
 }
 
+void ObjectsScene::updateGridTile(double zoom, double pen_width)
+{
+	/* The tile is rendered in device pixels for the current zoom so it doesn't get blurred
+	 * when the painter transformation is applied to the pattern brush */
+	int tile_sz = std::max(1, qRound(grid_size * zoom));
+	QString key = QString("%1:%2:%3:%4:%5").arg(tile_sz).arg(grid_size)
+																					.arg(static_cast<unsigned>(grid_pattern)).arg(grid_color.name(QColor::HexArgb))
+																					.arg(pen_width);
+
+	if(key == grid_tile_key && !grid_tile.isNull())
+		return;
+
+	QPainter painter;
+	QPen pen = QPen(grid_color, pen_width * (grid_pattern == GridPattern::DotPattern ? 1.50 : 1));
+	double scale = tile_sz / static_cast<double>(grid_size);
+
+	grid_tile = QImage(tile_sz, tile_sz, QImage::Format_ARGB32_Premultiplied);
+	grid_tile.fill(Qt::transparent);
+
+	painter.begin(&grid_tile);
+	painter.setRenderHint(QPainter::Antialiasing, false);
+	painter.scale(scale, scale);
+	painter.setPen(pen);
+
+	/* Since the tile is repeated side by side, only half of the lines/points on its borders
+	 * are drawn, the other half comes from the adjacent tiles */
+	if(grid_pattern == GridPattern::SquarePattern)
+		painter.drawRect(QRectF(QPointF(0, 0), QPointF(grid_size, grid_size)));
+	else
+	{
+		painter.drawPoint(0, 0);
+		painter.drawPoint(grid_size, 0);
+		painter.drawPoint(grid_size, grid_size);
+		painter.drawPoint(0, grid_size);
+	}
+
+	painter.end();
+	grid_tile_key = key;
+}
+
 void ObjectsScene::drawBackground(QPainter *painter, const QRectF &rect)
 {
 	double page_w = 0, page_h = 0,
@@ -751,7 +1047,7 @@ void ObjectsScene::drawBackground(QPainter *painter, const QRectF &rect)
 									BaseObjectView::getScreenDpiFactor();
 	QSizeF aux_size;
 	QPen pen = QPen(QColor(), pen_width);
-	int scene_lim_x = 0, scene_lim_y = 0;
+	double scene_lim_x = 0, scene_lim_y = 0;
 
 	// Retrieve the page rect considering the orientation, margin and page size
 	aux_size = page_layout.paintRect(QPageLayout::Point).size() * delim_factor;
@@ -769,31 +1065,29 @@ void ObjectsScene::drawBackground(QPainter *painter, const QRectF &rect)
 
 	if(show_grid)
 	{
-		int px = 0, py = 0;
+		double zoom = painter->worldTransform().m11() *
+									(painter->device() ? painter->device()->devicePixelRatioF() : 1);
+		QRectF grid_rect;
+		QBrush grid_brush;
 
-		pen.setWidthF(pen_width *	(grid_pattern == GridPattern::DotPattern ? 1.50 : 1));
-		pen.setColor(grid_color);
-		painter->setPen(pen);
+		// The grid is composed by entire cells so its limits are the scene size rounded up to the grid size
+		scene_lim_x = std::ceil(scene_w / grid_size) * grid_size;
+		scene_lim_y = std::ceil(scene_h / grid_size) * grid_size;
+
+		/* Instead of drawing each grid cell we fill only the exposed portion of the grid area
+		 * with a pre-rendered tile. The extra pen width includes the half of the lines/points
+		 * at the grid limits that lies outside the grid area */
+		grid_rect = rect.intersected(QRectF(0, 0, scene_lim_x + pen_width, scene_lim_y + pen_width));
 
-		//Draws the grid
-		for(px = 0; px < scene_w; px += grid_size)
+		if(!grid_rect.isEmpty() && zoom > 0)
 		{
-			for(py = 0; py < scene_h; py += grid_size)
-			{
-				if(grid_pattern == GridPattern::SquarePattern)
-					painter->drawRect(QRectF(QPointF(px, py), QPointF(px + grid_size, py + grid_size)));
-				else
-				{
-					painter->drawPoint(px, py);
-					painter->drawPoint(px + grid_size, py);
-					painter->drawPoint(px + grid_size, py + grid_size);
-					painter->drawPoint(px, py + grid_size);
-				}
-			}
+			updateGridTile(zoom, pen_width);
+			grid_brush.setTextureImage(grid_tile);
+			grid_brush.setTransform(QTransform::fromScale(grid_size / static_cast<double>(grid_tile.width()),
+																										grid_size / static_cast<double>(grid_tile.height())));
+			painter->setBrushOrigin(0, 0);
+			painter->fillRect(grid_rect, grid_brush);
 		}
-
-		scene_lim_x = px;
-		scene_lim_y = py;
 	}
 	else
 	{
@@ -801,21 +1095,34 @@ void ObjectsScene::drawBackground(QPainter *painter, const QRectF &rect)
 		scene_lim_y = scene_h;
 	}
 
-	//Creates the page delimiter lines
-	if(show_page_delim)
+	//Creates the page delimiter lines (only the ones crossing the exposed rect)
+	if(show_page_delim && page_w > 0 && page_h > 0)
 	{
+		int col_cnt = std::ceil(scene_w / page_w),
+				row_cnt = std::ceil(scene_h / page_h),
+				col_ini = std::max(0, static_cast<int>(std::floor(rect.left() / page_w)) - 1),
+				row_ini = std::max(0, static_cast<int>(std::floor(rect.top() / page_h)) - 1),
+				col_end = std::min(col_cnt - 1, static_cast<int>(std::floor(rect.right() / page_w))),
+				row_end = std::min(row_cnt - 1, static_cast<int>(std::floor(rect.bottom() / page_h)));
+		double px = 0, py = 0;
+
 		pen.setWidthF(pen_width * 1.15);
 		pen.setColor(delimiters_color);
 		pen.setStyle(Qt::CustomDashLine);
 		pen.setDashPattern({3, 5});
 		painter->setPen(pen);
 
-		for(int px = 0; px < scene_w; px += page_w)
+		/* Each page has its right and bottom borders drawn separately so the dash pattern
+		 * starts at the same position in all pages no matter which portion of the scene is exposed */
+		for(int col = col_ini; col <= col_end; col++)
 		{
-			for(int py = 0; py < scene_h; py += page_h)
+			px = col * page_w;
+
+			for(int row = row_ini; row <= row_end; row++)
 			{
-				painter->drawLine(px + page_w, py, px + page_w, py + page_h);
-				painter->drawLine(px, py + page_h, px + page_w, py + page_h);
+				py = row * page_h;
+				painter->drawLine(QPointF(px + page_w, py), QPointF(px + page_w, py + page_h));
+				painter->drawLine(QPointF(px, py + page_h), QPointF(px + page_w, py + page_h));
 			}
 		}
 	}
@@ -826,8 +1133,8 @@ void ObjectsScene::drawBackground(QPainter *painter, const QRectF &rect)
 		pen.setColor(QColor(255, 0, 0));
 		pen.setStyle(Qt::SolidLine);
 		painter->setPen(pen);
-		painter->drawLine(0, scene_lim_y, scene_lim_x, scene_lim_y);
-		painter->drawLine(scene_lim_x, 0, scene_lim_x, scene_lim_y);
+		painter->drawLine(QPointF(0, scene_lim_y), QPointF(scene_lim_x, scene_lim_y));
+		painter->drawLine(QPointF(scene_lim_x, 0), QPointF(scene_lim_x, scene_lim_y));
 	}
 
 	painter->restore();
@@ -990,13 +1297,21 @@ void ObjectsScene::addItem(QGraphicsItem *item)
 
 			// Tables and textboxes are observed for dimension changes so the layers they are in are correctly updated
 			if(tab || txtbox)
-				connect(obj, &BaseObjectView::s_objectDimensionChanged, this, &ObjectsScene::updateLayerRects);
+			{
+				connect(obj, &BaseObjectView::s_objectDimensionChanged, this, [this, obj](){
+					updateLayerRects({ obj });
+				});
+			}
 		}
 
 		QGraphicsScene::addItem(item);
 
 		if(tab || txtbox)
-			updateLayerRects();
+			updateLayerRects({ obj });
+		/* Schemas determine their boxes from the children indexed in the scene,
+		 * so they are reconfigured once they are added to it */
+		else if(dynamic_cast<SchemaView *>(item))
+			dynamic_cast<SchemaView *>(item)->configureObject();
 	}
 }
 
@@ -1008,7 +1323,10 @@ void ObjectsScene::removeItem(QGraphicsItem *item)
 		RelationshipView *rel=dynamic_cast<RelationshipView *>(item);
 
 		if(rel)
+		{
 			rel->disconnectTables();
+			cancelRelationshipUpdate(rel);
+		}
 
 		item->setVisible(false);
 		item->setActive(false);
@@ -1020,7 +1338,7 @@ void ObjectsScene::removeItem(QGraphicsItem *item)
 
 			if(BaseTable::isBaseTable(obj->getObjectType()) ||
 				 obj->getObjectType() == ObjectType::Textbox)
-				updateLayerRects();
+				updateLayerRects({ obj_view });
 
 			disconnect(obj_view, nullptr, this, nullptr);
 			disconnect(obj_view, nullptr, dynamic_cast<BaseGraphicObject*>(obj_view->getUnderlyingObject()), nullptr);
@@ -1297,6 +1615,7 @@ void ObjectsScene::keyPressEvent(QKeyEvent *event)
 		if(!moving_objs)
 		{
 			sel_ini_pnt = brect.center();
+			sel_ini_brect = itemsBoundingRect(true, true, true);
 			moving_objs = true;
 
 			/* If the object move timer is not active we need to send the
@@ -1402,6 +1721,7 @@ void ObjectsScene::mouseMoveEvent(QGraphicsSceneMouseEvent *event)
 				}
 
 				emit s_objectsMoved(false);
+				sel_ini_brect = itemsBoundingRect(true, true, true);
 				moving_objs=true;
 			}
 
@@ -1476,6 +1796,7 @@ void ObjectsScene::finishObjectsMove(const QPointF &pnt_end)
 	BaseTableView *tab_view=nullptr;
 	TableObjectView *tab_obj_view=nullptr;
 	QSet<BaseObjectView *> tables;
+	QList<BaseObjectView *> moved_objs;
 
 	//Gathering the relationships inside the selected schemsa in order to move their points too
 	for(auto &item : items)
@@ -1494,6 +1815,8 @@ void ObjectsScene::finishObjectsMove(const QPointF &pnt_end)
 
 		if(tab_view)
 			tables.insert(tab_view);
+		else if(obj_view && !sch_view && !dynamic_cast<RelationshipView *>(item))
+			moved_objs.append(obj_view);
 		else if(sch_view)
 		{
 			//Get the schema object
@@ -1598,64 +1921,115 @@ void ObjectsScene::finishObjectsMove(const QPointF &pnt_end)
 	moving_objs=false;
 	sel_ini_pnt.setX(DNaN);
 	sel_ini_pnt.setY(DNaN);
-	updateLayerRects();
 
-	QRectF rect = this->itemsBoundingRect();
-	rect.setTopLeft(QPointF(0,0));
-	rect.setWidth(rect.width() + (2 * grid_size));
-	rect.setHeight(rect.height() + (2 * grid_size));
-	setSceneRect(rect);
-	invalidate();
+	moved_objs.append(tables.values());
+	updateLayerRects(moved_objs);
+	updateSceneRect(sel_ini_brect, itemsBoundingRect(true, true, true));
+	sel_ini_brect = QRectF();
+
+	// The relationships of the moved tables are reconfigured before notifying the end of the move
+	updatePendingRelationships();
 
 	emit s_objectsMoved(true);
 }
 
-void ObjectsScene::alignObjectsToGrid()
+void ObjectsScene::updateSceneRect(const QRectF &old_brect, const QRectF &new_brect)
 {
-	QList<QGraphicsItem *> items=this->items();
-	RelationshipView *rel=nullptr;
-	BaseTableView *tab=nullptr;
+	double margin = 2 * grid_size;
+	QRectF scn_rect = this->sceneRect(), rect;
+
+	/* If the moved objects were delimiting the scene at its right/bottom edges the scene may
+	 * need to be shrunk, so we calculate the bounding rect of all items. Otherwise, the scene
+	 * is only expanded in case the objects' new positions exceed its limits */
+	if(!old_brect.isValid() ||
+		 old_brect.right() + margin >= scn_rect.right() ||
+		 old_brect.bottom() + margin >= scn_rect.bottom())
+	{
+		rect = this->itemsBoundingRect();
+		rect.setTopLeft(QPointF(0,0));
+		rect.setWidth(rect.width() + margin);
+		rect.setHeight(rect.height() + margin);
+	}
+	else
+	{
+		rect = scn_rect;
+
+		if(new_brect.right() + margin > rect.right())
+			rect.setRight(new_brect.right() + margin);
+
+		if(new_brect.bottom() + margin > rect.bottom())
+			rect.setBottom(new_brect.bottom() + margin);
+	}
+
+	if(rect != scn_rect)
+	{
+		setSceneRect(rect);
+
+		// The scene limits changed, so the background (grid and scene limit lines) of both old and new areas is redrawn
+		invalidate(scn_rect.united(rect), QGraphicsScene::BackgroundLayer);
+	}
+
+	// Repainting only the area where the objects were and where they are now
+	if(old_brect.isValid() && new_brect.isValid())
+		invalidate(old_brect.united(new_brect));
+	else
+		invalidate();
+}
+
+void ObjectsScene::alignItemToGrid(QGraphicsItem *item)
+{
+	if(!item)
+		return;
+
+	RelationshipView *rel=dynamic_cast<RelationshipView *>(item);
+	BaseTableView *tab=dynamic_cast<BaseTableView *>(item);
 	TextboxView *lab=nullptr;
 	std::vector<QPointF> points;
+	unsigned i, count;
+
+	if(tab)
+		tab->setPos(this->alignPointToGrid(tab->pos()));
+	else if(rel)
+	{
+		//Align the relationship points
+		points=rel->getUnderlyingObject()->getPoints();
+		count=points.size();
+		for(i=0; i < count; i++)
+			points[i]=this->alignPointToGrid(points[i]);
+
+		if(count > 0)
+		{
+			rel->getUnderlyingObject()->setPoints(points);
+			rel->configureLine();
+		}
+
+		//Align the labels
+		for(i=BaseRelationship::SrcCardLabel; i <= BaseRelationship::RelNameLabel; i++)
+		{
+			lab=rel->getLabel(static_cast<BaseRelationship::LabelId>(i));
+			if(lab)
+				lab->setPos(this->alignPointToGrid(lab->pos()));
+		}
+	}
+	else if(!dynamic_cast<SchemaView *>(item))
+		item->setPos(this->alignPointToGrid(item->pos()));
+}
+
+void ObjectsScene::alignObjectsToGrid()
+{
+	QList<QGraphicsItem *> items=this->items();
 	std::vector<Schema *> schemas;
-	unsigned i, count, i1, count1;
+	unsigned i, count;
 
 	count=items.size();
 	for(i=0; i < count; i++)
 	{
 		if(dynamic_cast<QGraphicsItemGroup *>(items[i]) && !items[i]->parentItem())
 		{
-			tab=dynamic_cast<BaseTableView *>(items[i]);
-			rel=dynamic_cast<RelationshipView *>(items[i]);
-
-			if(tab)
-				tab->setPos(this->alignPointToGrid(tab->pos()));
-			else if(rel)
-			{
-				//Align the relationship points
-				points=rel->getUnderlyingObject()->getPoints();
-				count1=points.size();
-				for(i1=0; i1 < count1; i1++)
-					points[i1]=this->alignPointToGrid(points[i1]);
-
-				if(count1 > 0)
-				{
-					rel->getUnderlyingObject()->setPoints(points);
-					rel->configureLine();
-				}
-
-				//Align the labels
-				for(i1=BaseRelationship::SrcCardLabel; i1 <= BaseRelationship::RelNameLabel; i1++)
-				{
-					lab=rel->getLabel(static_cast<BaseRelationship::LabelId>(i1));
-					if(lab)
-						lab->setPos(this->alignPointToGrid(lab->pos()));
-				}
-			}
-			else if(!dynamic_cast<SchemaView *>(items[i]))
-				items[i]->setPos(this->alignPointToGrid(items[i]->pos()));
-			else
+			if(dynamic_cast<SchemaView *>(items[i]))
 				schemas.push_back(dynamic_cast<Schema *>(dynamic_cast<BaseObjectView *>(items[i])->getUnderlyingObject()));
+			else
+				alignItemToGrid(items[i]);
 		}
 	}
 
@@ -64,6 +64,13 @@ class __libcanvas ObjectsScene: public QGraphicsScene {
 		//! \brief Stores the items used to represent layers around objects
 		QList<LayerItem *> layers_paths;
 
+		/*! \brief Stores per schema the spatial index of the rects (layer padding included) of the table-like objects in it.
+		 * This structure is used to determine the schemas' boxes without the need to visit all their children */
+		std::map<BaseObject *, RectIndex> schemas_idx;
+
+		//! \brief Stores the schema in which each table-like object view is currently indexed
+		std::map<BaseObjectView *, BaseObject *> indexed_schemas;
+
 		std::vector<BaseObjectView *> removed_objs;
 
 		//! \brief Holds the tables/views which have selected children objects
@@ -85,7 +92,10 @@ class __libcanvas ObjectsScene: public QGraphicsScene {
 
 		static constexpr int SceneMoveStep=20,
 		SceneMoveTimeout=50,
-		SceneMoveThreshold=30;
+		SceneMoveThreshold=30,
+
+		//! \brief Interval (in ms, roughly one frame) in which the pending relationships are reconfigured
+		RelsUpdateTimeout=16;
 
 		//! \brief Timer responsible to move the scene
 		QTimer scene_move_timer,
@@ -103,6 +113,12 @@ class __libcanvas ObjectsScene: public QGraphicsScene {
 		key presses/releases aren't not registered in the operation history */
 		object_move_timer;
 
+		//! \brief Relationships waiting to have their lines reconfigured (see scheduleRelationshipUpdate())
+		QSet<RelationshipView *> pending_rels;
+
+		//! \brief Timer responsible to reconfigure the pending relationships at most once per frame
+		QTimer rels_update_timer;
+
 		//! \brief Attributes used to control the direction of scene movement when user puts cursor at corners
 		int scene_move_dx, scene_move_dy;
 
@@ -135,6 +151,22 @@ class __libcanvas ObjectsScene: public QGraphicsScene {
 		//! \brief Initial point of selection rectangle
 		QPointF sel_ini_pnt;
 
+		//! \brief Bounding rect of the selected objects (layer rects included) when they start to be moved
+		QRectF sel_ini_brect;
+
+		//! \brief Stores the level of detail in which the objects are currently rendered (see setLevelOfDetail())
+		BaseObjectView::LevelOfDetail curr_lod;
+
+		//! \brief Indicates if the objects in the scene can be rendered using item cache (see setObjectsCacheEnabled())
+		bool objs_cache_enabled;
+
+		//! \brief Pre-rendered grid cell used as pattern brush when drawing the scene background
+		QImage grid_tile;
+
+		/*! \brief Identifies the settings (zoom, grid size, pattern, color, etc) used to render the grid tile.
+		 * When any of these settings change the tile is rendered again */
+		QString grid_tile_key;
+
 		//! \brief Rectangle used to select several objects on the scene
 		QGraphicsPolygonItem *selection_rect;
 
@@ -160,6 +192,25 @@ class __libcanvas ObjectsScene: public QGraphicsScene {
 
 		void clearTablesChildrenSelection();
 
+		/*! \brief Stores in the layer items the object's rects for each active layer it is in.
+		 * Returns the ids of the layers in which the rects were stored */
+		QList<unsigned> storeLayerRects(BaseObjectView *obj_view);
+
+		//! \brief Updates only the paths of the layers that contain the provided objects (before or after they change)
+		void updateLayerRects(const QList<BaseObjectView *> &objs);
+
+		/*! \brief Returns the rect of a table-like object used to compose its schema's box. The rect includes
+		 * the space occupied by the boxes of the visible layers in which the object is */
+		QRectF getSchemaChildRect(BaseObjectView *obj_view);
+
+		/*! \brief Updates the scene rect after moving objects considering their bounding rect before (old_brect) and after
+		 * (new_brect) the movement. The bounding rect of all items is calculated only if the scene may need to be shrunk,
+		 * and only the affected regions are repainted */
+		void updateSceneRect(const QRectF &old_brect, const QRectF &new_brect);
+
+		//! \brief Renders the grid tile for the provided zoom factor if the current one is outdated
+		void updateGridTile(double zoom, double pen_width);
+
 	protected:
 		void drawBackground(QPainter *painter, const QRectF &rect);
 
@@ -268,6 +319,30 @@ class __libcanvas ObjectsScene: public QGraphicsScene {
 		//! \brief Toggles the display of the red lines that denotes the scene boundaries
 		void setShowSceneLimits(bool show);
 
+		/*! \brief Defines the level of detail in which the objects are rendered. Relationships are reconfigured
+		 * when the level of detail changes in order to hide/restore their descriptors, labels and attributes, while
+		 * tables and views use it to decide if their children must be drawn (see BaseObjectView::getLevelOfDetail) */
+		void setLevelOfDetail(BaseObjectView::LevelOfDetail lod);
+
+		//! \brief Returns the level of detail in which the objects are currently rendered
+		BaseObjectView::LevelOfDetail getLevelOfDetail();
+
+		/*! \brief Enables/disables the item cache of the objects in the scene (only when BaseObjectView::isItemCacheEnabled is true).
+		 * The cache must be disabled while printing or exporting the scene to vector formats, otherwise, the objects would be
+		 * drawn as the cached pixmaps in the output */
+		void setObjectsCacheEnabled(bool enable);
+
+		//! \brief Returns if the objects in the scene can be rendered using item cache
+		bool isObjectsCacheEnabled();
+
+		/*! \brief Schedules the reconfiguration of the relationship's line. The relationships scheduled until
+		 * the next frame are reconfigured only once, no matter how many times they were scheduled (e.g. when
+		 * both tables linked by a relationship are moved together) */
+		void scheduleRelationshipUpdate(RelationshipView *rel);
+
+		//! \brief Removes the relationship from the list of pending updates
+		void cancelRelationshipUpdate(RelationshipView *rel);
+
 		static void setEnableCornerMove(bool enable);
 		static void setInvertRangeSelectionTrigger(bool invert);
 		static bool isCornerMoveEnabled();
@@ -346,12 +421,31 @@ class __libcanvas ObjectsScene: public QGraphicsScene {
 		bool isLayerRectsVisible();
 		bool isLayerNamesVisible();
 
+		/*! \brief Updates the rect of the table-like object in the spatial index of its schema. If the object
+		 * changed its schema or isn't in the scene anymore its rect is moved to the new schema or removed.
+		 * This method is called by the views whenever their geometry changes */
+		void updateSchemaIndex(BaseObjectView *obj_view);
+
+		//! \brief Returns the rect that contains all the table-like objects in the schema (including their layers boxes)
+		QRectF getSchemaChildrenRect(BaseObject *schema);
+
+		//! \brief Returns the views of the table-like objects in the schema which are in the scene
+		QList<BaseObjectView *> getSchemaChildren(BaseObject *schema);
+
 	public slots:
 		//! \brief Force the update of all layer rectangles
 		void updateLayerRects();
 
+		//! \brief Immediately reconfigures the lines of all relationships with pending updates
+		void updatePendingRelationships();
+
 		void setLayerRectsVisible(bool value);
 		void setLayerNamesVisible(bool value);
+
+		/*! \brief Aligns a single object (table, relationship, textbox) to the grid. Schemas are ignored
+		 *  since their dimensions depend on the children objects */
+		void alignItemToGrid(QGraphicsItem *item);
+
 		void alignObjectsToGrid();
 		void update();
 		void clearSelection();
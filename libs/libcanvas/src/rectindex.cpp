@@ -0,0 +1,212 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "rectindex.h"
+#include <cmath>
+
+void RectIndex::getCellRange(const QRectF &rect, int &col1, int &row1, int &col2, int &row2) const
+{
+	QRectF nrect = rect.normalized();
+
+	col1 = static_cast<int>(std::floor(nrect.left() / CellSize));
+	row1 = static_cast<int>(std::floor(nrect.top() / CellSize));
+	col2 = static_cast<int>(std::floor(nrect.right() / CellSize));
+	row2 = static_cast<int>(std::floor(nrect.bottom() / CellSize));
+}
+
+void RectIndex::insertRect(QGraphicsItem *item, const QRectF &rect)
+{
+	int col1 = 0, row1 = 0, col2 = 0, row2 = 0;
+
+	getCellRange(rect, col1, row1, col2, row2);
+
+	for(int col = col1; col <= col2; col++)
+	{
+		for(int row = row1; row <= row2; row++)
+			cells[{ col, row }].insert(item);
+	}
+
+	left_edges.insert(rect.left());
+	top_edges.insert(rect.top());
+	right_edges.insert(rect.right());
+	bottom_edges.insert(rect.bottom());
+}
+
+void RectIndex::eraseRect(QGraphicsItem *item, const QRectF &rect)
+{
+	int col1 = 0, row1 = 0, col2 = 0, row2 = 0;
+	std::map<CellKey, std::set<QGraphicsItem *>>::iterator itr;
+
+	getCellRange(rect, col1, row1, col2, row2);
+
+	for(int col = col1; col <= col2; col++)
+	{
+		for(int row = row1; row <= row2; row++)
+		{
+			itr = cells.find({ col, row });
+
+			if(itr == cells.end())
+				continue;
+
+			itr->second.erase(item);
+
+			// Empty cells are discarded so the grid doesn't grow indefinitely as the items move
+			if(itr->second.empty())
+				cells.erase(itr);
+		}
+	}
+
+	// Only one occurrence of each edge is removed since other rects may share the same value
+	left_edges.erase(left_edges.find(rect.left()));
+	top_edges.erase(top_edges.find(rect.top()));
+	right_edges.erase(right_edges.find(rect.right()));
+	bottom_edges.erase(bottom_edges.find(rect.bottom()));
+}
+
+void RectIndex::setRect(QGraphicsItem *item, const QRectF &rect)
+{
+	if(!item)
+		return;
+
+	auto itr = items_rects.find(item);
+
+	if(itr != items_rects.end())
+	{
+		if(itr->second == rect)
+			return;
+
+		eraseRect(item, itr->second);
+		itr->second = rect;
+	}
+	else
+		items_rects[item] = rect;
+
+	insertRect(item, rect);
+}
+
+bool RectIndex::removeRect(QGraphicsItem *item)
+{
+	auto itr = items_rects.find(item);
+
+	if(itr == items_rects.end())
+		return false;
+
+	eraseRect(item, itr->second);
+	items_rects.erase(itr);
+	return true;
+}
+
+bool RectIndex::contains(QGraphicsItem *item) const
+{
+	return items_rects.count(item) != 0;
+}
+
+QRectF RectIndex::getRect(QGraphicsItem *item) const
+{
+	auto itr = items_rects.find(item);
+
+	if(itr == items_rects.end())
+		return QRectF();
+
+	return itr->second;
+}
+
+void RectIndex::clear()
+{
+	items_rects.clear();
+	cells.clear();
+	left_edges.clear();
+	top_edges.clear();
+	right_edges.clear();
+	bottom_edges.clear();
+}
+
+bool RectIndex::isEmpty() const
+{
+	return items_rects.empty();
+}
+
+int RectIndex::getCount() const
+{
+	return static_cast<int>(items_rects.size());
+}
+
+QRectF RectIndex::getBoundingRect() const
+{
+	if(items_rects.empty())
+		return QRectF();
+
+	return QRectF(QPointF(*left_edges.begin(), *top_edges.begin()),
+								QPointF(*right_edges.rbegin(), *bottom_edges.rbegin()));
+}
+
+QList<QRectF> RectIndex::getRects() const
+{
+	QList<QRectF> rects;
+
+	for(auto &itr : items_rects)
+		rects.append(itr.second);
+
+	return rects;
+}
+
+QList<QRectF> RectIndex::getRects(const QRectF &area) const
+{
+	QList<QRectF> rects;
+	std::set<QGraphicsItem *> items;
+	int col1 = 0, row1 = 0, col2 = 0, row2 = 0;
+	std::map<CellKey, std::set<QGraphicsItem *>>::const_iterator itr;
+	QRectF rect;
+
+	if(items_rects.empty())
+		return rects;
+
+	// Restricting the area to the bounding rect avoids visiting the cells of large empty regions
+	getCellRange(area.normalized().intersected(getBoundingRect()), col1, row1, col2, row2);
+
+	for(int col = col1; col <= col2; col++)
+	{
+		for(int row = row1; row <= row2; row++)
+		{
+			itr = cells.find({ col, row });
+
+			if(itr != cells.end())
+				items.insert(itr->second.begin(), itr->second.end());
+		}
+	}
+
+	for(auto &item : items)
+	{
+		rect = items_rects.at(item);
+
+		if(rect.intersects(area))
+			rects.append(rect);
+	}
+
+	return rects;
+}
+
+QList<QGraphicsItem *> RectIndex::getItems() const
+{
+	QList<QGraphicsItem *> items;
+
+	for(auto &itr : items_rects)
+		items.append(itr.first);
+
+	return items;
+}
@@ -0,0 +1,96 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libcanvas
+\class RectIndex
+\brief Implements a spatial index of the rectangles occupied by graphical items. The rectangles are distributed
+in a grid of fixed size cells so the ones intersecting a certain area can be retrieved without visiting all of them,
+and their edges are kept sorted so the bounding rect of the whole set is determined without a full scan.
+This class is used to keep track of the rects of the objects in the layers and schemas of the canvas.
+*/
+
+#ifndef RECT_INDEX_H
+#define RECT_INDEX_H
+
+#include "canvasglobal.h"
+#include <QGraphicsItem>
+#include <map>
+#include <set>
+
+class __libcanvas RectIndex {
+	private:
+		//! \brief The size (width and height) of each cell in the grid
+		static constexpr double CellSize = 512.0;
+
+		using CellKey = std::pair<int, int>;
+
+		//! \brief Stores the current rect of each indexed item
+		std::map<QGraphicsItem *, QRectF> items_rects;
+
+		//! \brief Stores the items which rects intersect each cell of the grid
+		std::map<CellKey, std::set<QGraphicsItem *>> cells;
+
+		//! \brief Stores the sorted edges of the rects used to determine the bounding rect of the index
+		std::multiset<double> left_edges, top_edges, right_edges, bottom_edges;
+
+		//! \brief Returns the range of cells (inclusive) that the provided rect intersects
+		void getCellRange(const QRectF &rect, int &col1, int &row1, int &col2, int &row2) const;
+
+		//! \brief Inserts the rect of the item in the grid and edges structures
+		void insertRect(QGraphicsItem *item, const QRectF &rect);
+
+		//! \brief Removes the rect of the item from the grid and edges structures
+		void eraseRect(QGraphicsItem *item, const QRectF &rect);
+
+	public:
+		RectIndex() = default;
+
+		/*! \brief Stores the rect of the item replacing the previous one (if any).
+		 * The cost of the operation is logarithmic on the amount of indexed rects */
+		void setRect(QGraphicsItem *item, const QRectF &rect);
+
+		//! \brief Removes the rect of the item returning true when it was indexed
+		bool removeRect(QGraphicsItem *item);
+
+		//! \brief Returns if the item has a rect in the index
+		bool contains(QGraphicsItem *item) const;
+
+		//! \brief Returns the indexed rect of the item or an invalid rect if the item isn't indexed
+		QRectF getRect(QGraphicsItem *item) const;
+
+		void clear();
+
+		bool isEmpty() const;
+
+		int getCount() const;
+
+		//! \brief Returns the rect that contains all the indexed rects
+		QRectF getBoundingRect() const;
+
+		//! \brief Returns all the indexed rects
+		QList<QRectF> getRects() const;
+
+		//! \brief Returns only the indexed rects that intersect the provided area
+		QList<QRectF> getRects(const QRectF &area) const;
+
+		//! \brief Returns all the indexed items
+		QList<QGraphicsItem *> getItems() const;
+};
+
+#endif
@@ -17,6 +17,7 @@
 */
 
 #include "relationshipview.h"
+#include "objectsscene.h"
 
 bool RelationshipView::hide_name_label=false;
 bool RelationshipView::use_curved_lines=true;
@@ -80,6 +81,10 @@ RelationshipView::~RelationshipView()
 {
 	QGraphicsItem *item=nullptr;
 	std::vector<std::vector<QGraphicsLineItem *> *> rel_lines = { &lines, &fk_lines, &pk_lines, &src_cf_lines, &dst_cf_lines };
+	ObjectsScene *scene = dynamic_cast<ObjectsScene *>(this->scene());
+
+	if(scene)
+		scene->cancelRelationshipUpdate(this);
 
 	while(!curves.empty())
 	{
@@ -536,11 +541,11 @@ void RelationshipView::connectTables()
 			tables[i]->disconnect(this);
 
 			if(BaseObjectView::isPlaceholderEnabled())
-				connect(tables[i], &BaseTableView::s_relUpdateRequest, this, &RelationshipView::configureLine);
+				connect(tables[i], &BaseTableView::s_relUpdateRequest, this, &RelationshipView::requestLineUpdate);
 			else
-				connect(tables[i], &BaseTableView::s_objectMoved, this, &RelationshipView::configureLine);
+				connect(tables[i], &BaseTableView::s_objectMoved, this, &RelationshipView::requestLineUpdate);
 
-			connect(tables[i], &BaseTableView::s_objectDimensionChanged, this, &RelationshipView::configureLine);
+			connect(tables[i], &BaseTableView::s_objectDimensionChanged, this, &RelationshipView::requestLineUpdate);
 		}
 	}
 }
@@ -562,6 +567,16 @@ void RelationshipView::configureObject()
 	connect(rel_base, &BaseRelationship::s_objectModified, this, &RelationshipView::configureLine);
 }
 
+void RelationshipView::requestLineUpdate()
+{
+	ObjectsScene *scene = dynamic_cast<ObjectsScene *>(this->scene());
+
+	if(scene)
+		scene->scheduleRelationshipUpdate(this);
+	else
+		configureLine();
+}
+
 void RelationshipView::configurePositionInfo()
 {
 	if(this->isSelected())
@@ -598,6 +613,7 @@ void RelationshipView::configureLine()
 		bool conn_same_sides = false,
 				conn_horiz_sides[2] = { false, false }, conn_vert_sides[2] = { false, false };
 		BaseRelationship::RelType rel_type = base_rel->getRelationshipType();
+		LevelOfDetail lod = getSceneLevelOfDetail();
 
 		configuring_line=true;
 		pen.setCapStyle(Qt::RoundCap);
@@ -1122,8 +1138,8 @@ void RelationshipView::configureLine()
 			line_circles[1]->setVisible(false);
 		}
 
-		//Using bezier curves instead of straight lines to denote the relationship line
-		if(use_curved_lines && !base_rel->isSelfRelationship())
+		//Using bezier curves instead of straight lines to denote the relationship line (except in the lowest level of detail)
+		if(use_curved_lines && !base_rel->isSelfRelationship() && lod != BoxOnly)
 		{
 			BezierCurveItem * curve = nullptr;
 			bool invert_cpoints = false, simple_curve = false;
@@ -1174,7 +1190,7 @@ void RelationshipView::configureLine()
 				i1--;
 			}
 		}
-		else if(!use_curved_lines && !lines.empty() && !curves.empty())
+		else if(!lines.empty() && !curves.empty())
 		{
 			BezierCurveItem *curve = nullptr;
 
@@ -1190,11 +1206,18 @@ void RelationshipView::configureLine()
 			}
 		}
 
-		this->configureDescriptor();
+		/* In reduced levels of detail the descriptors, labels and attributes are not configured
+		 * until the scene is rendered in full detail again (see ObjectsScene::setLevelOfDetail) */
+		if(lod == FullDetail)
+		{
+			this->configureDescriptor();
 
-		this->configureCrowsFootDescriptors();
+			this->configureCrowsFootDescriptors();
 
-		this->configureLabels();
+			this->configureLabels();
+		}
+		else
+			this->hideDecorations();
 
 		this->configureProtectedIcon();
 
@@ -1396,6 +1419,9 @@ void RelationshipView::configureDescriptor()
 										rel_type == BaseRelationship::RelationshipPart));
 	descriptor->setVisible(visible);
 	obj_shadow->setVisible(visible);
+
+	//Restoring the selection descriptor which is hidden in reduced levels of detail (see hideDecorations())
+	obj_selection->setVisible(this->isSelected() && descriptor->isVisible());
 }
 
 void RelationshipView::configureCrowsFootDescriptors()
@@ -1660,6 +1686,28 @@ void RelationshipView::configureCrowsFootDescriptors()
 	}
 }
 
+void RelationshipView::hideDecorations()
+{
+	descriptor->setVisible(false);
+	obj_shadow->setVisible(false);
+	obj_selection->setVisible(false);
+
+	for(auto &label : labels)
+	{
+		if(label)
+			label->setVisible(false);
+	}
+
+	for(auto &attrib : attributes)
+		attrib->setVisible(false);
+
+	for(auto &cf_desc : cf_descriptors)
+	{
+		if(cf_desc)
+			cf_desc->setVisible(false);
+	}
+}
+
 void RelationshipView::configureAttributes()
 {
 	Relationship *rel=dynamic_cast<Relationship *>(this->getUnderlyingObject());
@@ -1747,6 +1795,7 @@ void RelationshipView::configureAttributes()
 		sel_attrib->setBrush(BaseObjectView::getFillStyle(Attributes::ObjSelection));
 
 		attrib->setPos(px, py);
+		attrib->setVisible(true);
 
 		text->setText(compact_view && !col->getAlias().isEmpty() ? col->getAlias() : col->getName());
 		text->setPos(QPointF(desc->pos().x() + desc->boundingRect().width() + (HorizSpacing * factor),
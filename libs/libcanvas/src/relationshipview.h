@@ -132,6 +132,10 @@ class __libcanvas RelationshipView: public BaseObjectView {
 		//! \brief Configures the attributes positioning
 		void configureAttributes();
 
+		/*! \brief Hides the descriptors, labels and attributes of the relationship. This method is used instead of configuring
+		 * these objects when the scene renders the objects in a reduced level of detail */
+		void hideDecorations();
+
 		//! \brief Configures the position info object
 		void configurePositionInfo();
 
@@ -206,6 +210,10 @@ class __libcanvas RelationshipView: public BaseObjectView {
 		//! \brief Configures the relationship line
 		void configureLine();
 
+		/*! \brief Requests the scene to reconfigure the relationship's line in the next frame (see ObjectsScene::scheduleRelationshipUpdate).
+		 * If the relationship is not in an ObjectsScene the line is reconfigured immediately */
+		void requestLineUpdate();
+
 		//! \brief Returns the label through its index
 		TextboxView *getLabel(BaseRelationship::LabelId lab_idx);
 
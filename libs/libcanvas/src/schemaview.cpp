@@ -73,24 +73,14 @@ void SchemaView::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
 
 void SchemaView::fetchChildren()
 {
-	Schema *schema=dynamic_cast<Schema *>(this->getUnderlyingObject());
-	DatabaseModel *model=dynamic_cast<DatabaseModel *>(schema->getDatabase());
-	std::vector<BaseObject *> objs, list;
-	std::vector<ObjectType> types = { ObjectType::Table, ObjectType::ForeignTable, ObjectType::View };
-
-	//Gets all tables and views that belongs to the schema
-	for(auto &type : types)
-	{
-		list = model->getObjects(type, schema);
-		objs.insert(objs.end(), list.begin(), list.end());
-	}
+	ObjectsScene *scene = dynamic_cast<ObjectsScene *>(this->scene());
 
+	/* The children are retrieved from the schema's spatial index kept by the scene
+	 * instead of scanning all the tables and views in the model */
 	children.clear();
-	while(!objs.empty())
-	{
-		children.push_front(dynamic_cast<BaseObjectView *>(dynamic_cast<BaseGraphicObject *>(objs.back())->getOverlyingObject()));
-		objs.pop_back();
-	}
+
+	if(scene)
+		children = scene->getSchemaChildren(this->getUnderlyingObject());
 }
 
 void SchemaView::selectChildren()
@@ -177,58 +167,21 @@ void SchemaView::configureObject()
 	if(schema->isRectVisible() && !children.isEmpty())
 	{
 		QColor color;
-		QRectF rect;
+		QRectF rect, children_rect;
 		QFont font;
 		double sp_h=0, sp_v=0, txt_h=0,
-		x1=1000000, y1=1000000, x2=-1000000, y2=-1000000, width=0,
-		height = 0, size_inc = 0, left_inc = 0, top_inc = 0;
-		QList<BaseObjectView *>::Iterator itr=children.begin();
-		BaseObjectView *obj_view = nullptr;
+		x1=0, y1=0, x2=0, y2=0, width=0, height = 0;
 		ObjectsScene *scene = dynamic_cast<ObjectsScene *>(this->scene());
-		QFontMetricsF fm(LayerItem::getDefaultFont());
-		QList<unsigned> act_layers = scene->getActiveLayersIds();
-		int num_layers = 0;
 
 		last_pos = schema->getPosition();
 
-		//Configures the bounding rect based upon the children dimension
-		while(itr!=children.end())
-		{
-			obj_view = dynamic_cast<BaseObjectView *>(*itr);
-
-			if(scene && scene->isLayerRectsVisible())
-			{
-				num_layers = 0;
-
-				/* Determining the amount of visible layers of the object
-				 * in order to generated the correct bounding rect dimension */
-				for(auto &layer_id : obj_view->getLayers())
-				{
-					if(act_layers.contains(layer_id))
-						num_layers++;
-				}
-
-				size_inc = left_inc = top_inc = LayerItem::LayerPadding * num_layers;
-
-				if(scene->isLayerNamesVisible())
-					top_inc = fm.height() * num_layers;
-			}
-
-			rect.setTopLeft(obj_view->pos() - QPointF(left_inc, top_inc));
-			rect.setSize(obj_view->boundingRect().size() + QSizeF(2 * size_inc, size_inc + top_inc));
-
-			if(rect.left() < x1)
-				x1 = rect.left();
-			if(rect.right() > x2)
-				x2 = rect.right();
-
-			if(rect.top() < y1)
-				y1 = rect.top();
-			if(rect.bottom() > y2)
-				y2 = rect.bottom();
-
-			itr++;
-		}
+		/* Configures the bounding rect based upon the children dimension. The rect containing all
+		 * children (and their layers boxes) is retrieved from the index without visiting them */
+		children_rect = scene->getSchemaChildrenRect(schema);
+		x1 = children_rect.left();
+		y1 = children_rect.top();
+		x2 = children_rect.right();
+		y2 = children_rect.bottom();
 
 		//Configures the schema name at the top
 		sch_name->setText(compact_view && !schema->getAlias().isEmpty() ? schema->getAlias() : schema->getName());
@@ -287,6 +240,7 @@ void SchemaView::configureObject()
 		this->configureProtectedIcon();
 		this->configurePositionInfo(this->pos());
 		this->configureSQLDisabledInfo();
+		this->configureItemCache();
 	}
 	else
 		this->setVisible(false);
@@ -50,7 +50,7 @@ class __libcanvas SchemaView: public BaseObjectView {
 		void mousePressEvent(QGraphicsSceneMouseEvent *event);
 		void mouseReleaseEvent(QGraphicsSceneMouseEvent *event);
 
-		//! \brief Fills the children vector
+		//! \brief Fills the children vector with the views indexed by the scene in the schema
 		void fetchChildren();
 
 		//! \brief Returns if all children are selected
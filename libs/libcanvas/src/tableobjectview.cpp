@@ -730,6 +730,10 @@ void TableObjectView::configureObjectSelection()
 
 void TableObjectView::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
 {
+	//In reduced levels of detail the table's children aren't drawn
+	if(getLevelOfDetail(this, painter) != FullDetail)
+		return;
+
 	painter->save();
 	painter->translate(descriptor->pos());
 	descriptor->paint(painter, option, widget);
@@ -154,6 +154,10 @@ void TableTitleView::paint(QPainter *painter, const QStyleOptionGraphicsItem *op
 {
 	box->paint(painter, option, widget);
 
+	//In the lowest level of detail only the title box is drawn
+	if(getLevelOfDetail(this, painter) == BoxOnly)
+		return;
+
 	painter->setFont(schema_name->font());
 	painter->setPen(schema_name->brush().color());
 	painter->drawText(schema_name->pos(), schema_name->text());
@@ -28,8 +28,10 @@ void TableView::configureObject()
 {
 	/* If the table isn't visible we abort the current configuration
 	 * and mark its geometry update as pending so in the next call to
-	 * setVisible(true) the geometry can be updated (see BaseObjectView::itemChange()) */
-	if(!this->isVisible())
+	 * setVisible(true) the geometry can be updated (see BaseObjectView::itemChange()).
+	 * The same is done while the scene is rendered in a reduced level of detail, in this case
+	 * the geometry is updated when the scene is rendered in full detail again */
+	if(!this->isVisible() || isGeometryUpdateDeferred())
 	{
 		pending_geom_update = true;
 		return;
@@ -22,6 +22,7 @@ BaseGraphicObject::BaseGraphicObject()
 {
 	is_modified=true;
 	is_faded_out=false;
+	overlying_obj_deferred=false;
 	attributes[Attributes::XPos]="";
 	attributes[Attributes::YPos]="";
 	attributes[Attributes::Position]="";
@@ -124,13 +125,32 @@ void BaseGraphicObject::setReceiverObject(QObject *obj)
 		disconnect(this, nullptr, receiver_object, nullptr);
 
 	receiver_object=obj;
+
+	if(receiver_object)
+		overlying_obj_deferred=false;
 }
 
 QObject *BaseGraphicObject::getOverlyingObject()
 {
+	//Resetting the flag before emitting the signal to avoid recursive or concurrent requests
+	if(!receiver_object && overlying_obj_deferred.exchange(false))
+	{
+		emit s_overlyingObjectRequested(this);
+	}
+
 	return receiver_object;
 }
 
+void BaseGraphicObject::setOverlyingObjectDeferred(bool value)
+{
+	overlying_obj_deferred = value && !receiver_object;
+}
+
+bool BaseGraphicObject::isOverlyingObjectDeferred()
+{
+	return overlying_obj_deferred;
+}
+
 bool BaseGraphicObject::isGraphicObject(ObjectType type)
 {
 	return (type==ObjectType::Table || type==ObjectType::View || type==ObjectType::Relationship ||
@@ -30,6 +30,7 @@ this is treated in the BaseObjectView class on libobjrenderer library
 
 #include <QObject>
 #include <QPointF>
+#include <atomic>
 #include "baseobject.h"
 
 //! \brief Enum used to reference object color ids
@@ -54,6 +55,12 @@ class __libcore BaseGraphicObject: public QObject, public BaseObject {
 		//! \brief Indicates if the graphical representation of this object is faded out
 		is_faded_out;
 
+		/*! \brief Indicates that the creation of the overlying object was deferred. In that case,
+		 * the first call to getOverlyingObject() emits s_overlyingObjectRequested() so the
+		 * graphical representation can be created on demand. This flag is atomic since the
+		 * overlying object can be requested from a thread other than the one that deferred it */
+		std::atomic<bool> overlying_obj_deferred;
+
 		/*! \brief Stores a reference to the object which is currently the receiver
 		 of signals emitted by the instance of this class. The receiver is an object that
 		 represents the 'this' object in the QGraphicsScene. This attribute breaks
@@ -121,9 +128,18 @@ class __libcore BaseGraphicObject: public QObject, public BaseObject {
 		//! \brief Assigns on object to other mading the correct attribute copy
 		void operator = (BaseGraphicObject &obj);
 
-		//! \brief Gets the current overlying (top object, scene object) that graphically represents the 'this' object
+		/*! \brief Gets the current overlying (top object, scene object) that graphically represents the 'this' object.
+		 * If the creation of the overlying object was deferred the signal s_overlyingObjectRequested() is emitted
+		 * before returning the object, giving the chance to the graphical representation to be created */
 		QObject *getOverlyingObject();
 
+		/*! \brief Defines if the creation of the overlying object was deferred, meaning that the object has
+		 * no graphical representation yet but it'll have one eventually (see getOverlyingObject()) */
+		void setOverlyingObjectDeferred(bool value);
+
+		//! \brief Returns if the creation of the overlying object is deferred
+		bool isOverlyingObjectDeferred();
+
 		//! \brief Returns the code definition of the object
 		virtual QString getSourceCode(SchemaParser::CodeType)=0;
 
@@ -162,6 +178,9 @@ class __libcore BaseGraphicObject: public QObject, public BaseObject {
 		//! \brief Signal emitted when the user calls the setProtected() method
 		void s_objectProtected(bool);
 
+		//! \brief Signal emitted when the overlying object is requested while its creation is deferred
+		void s_overlyingObjectRequested(BaseGraphicObject *object);
+
 		friend class BaseObjectView;
 		friend class DatabaseModel;
 		friend class OperationList;
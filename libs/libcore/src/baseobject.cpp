@@ -86,6 +86,7 @@ BaseObject::BaseObject()
 	object_id=BaseObject::global_id++;
 	is_protected=system_obj=sql_disabled=false;
 	code_invalidated=true;
+	code_exported=false;
 	obj_type=ObjectType::BaseObject;
 	schema=nullptr;
 	owner=nullptr;
@@ -986,6 +987,10 @@ void BaseObject::swapObjectsIds(BaseObject *obj1, BaseObject *obj2, bool enable_
 	unsigned id_bkp=obj1->object_id;
 	obj1->object_id=obj2->object_id;
 	obj2->object_id=id_bkp;
+
+	//Swapping ids changes the creation order of the objects so their models need to be notified
+	obj1->setCodeInvalidated(true);
+	obj2->setCodeInvalidated(true);
 }
 
 void BaseObject::updateObjectId(BaseObject *obj)
@@ -999,7 +1004,10 @@ void BaseObject::updateObjectId(BaseObject *obj)
 						.arg(obj->getTypeName()),
 						ErrorCode::OprReservedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 	else
+	{
 		obj->object_id=++global_id;
+		obj->setCodeInvalidated(true);
+	}
 }
 
 std::vector<ObjectType> BaseObject::getObjectTypes(bool inc_table_objs, std::vector<ObjectType> exclude_types)
@@ -1120,6 +1128,17 @@ void BaseObject::operator = (BaseObject &obj)
 
 void BaseObject::setCodeInvalidated(bool value)
 {
+	//Any invalidation means that the exported code is outdated
+	if(value)
+	{
+		code_exported=false;
+
+		/* Notifying the model that one of its objects was changed so it can discard
+		 * the information that depends on the objects' state (e.g. the creation order) */
+		if(database && database != this)
+			database->setCodeInvalidated(true);
+	}
+
 	if(use_cached_code && value!=code_invalidated)
 	{
 		if(value)
@@ -1148,10 +1167,19 @@ bool BaseObject::isCodeInvalidated()
 	return (use_cached_code && code_invalidated);
 }
 
+void BaseObject::setCodeExported(bool value)
+{
+	code_exported=(use_cached_code && value);
+}
+
+bool BaseObject::isCodeExported()
+{
+	return (use_cached_code && code_exported && !code_invalidated);
+}
+
 bool BaseObject::isCodeDiffersFrom(const QString &xml_def1, const QString &xml_def2, const QStringList &ignored_attribs, const QStringList &ignored_tags)
 {
-	QString xml, tag=QString("<%1").arg(this->getSchemaName()),
-			attr_regex=QString("(%1=\")"),
+	QString xml, attr_regex=QString("(%1=\")"),
 			tag_regex=QString("<%1[^>]*((/>)|(>((?:(?!</%1>).)*)</%1>))");
 	QStringList xml_defs{ xml_def1, xml_def2 };
 	int start=0, end=-1, tag_end=-1;
@@ -145,7 +145,11 @@ class __libcore BaseObject {
 				automatically change the value of this attribute when the respective set[Attribute]() is called. For all the
 				rest the method setCodeInvalidated() should be explicitly called if you need to invalidate the code and
 				generate it again */
-		code_invalidated;
+		code_invalidated,
+
+		/*! \brief Indicates if the SQL code of the object was exported to a file and it was not invalidated since then.
+				This flag is used to avoid generating the code of unchanged objects in incremental exports */
+		code_exported;
 
 		//! \brief Stores the cached xml and sql code
 		QString cached_code[2],
@@ -238,10 +242,6 @@ class __libcore BaseObject {
 		ALTER, COMMENT and DROP commands must be generated. Refer to schema files for comments, drop and alter. */
 		void setBasicAttributes(bool format_name);
 
-		/*! \brief Compares two xml buffers and returns if they differs from each other. The user can specify which attributes
-	and tags must be ignored when makin the comparison. NOTE: only the name for attributes and tags must be informed */
-		bool isCodeDiffersFrom(const QString &xml_def1, const QString &xml_def2, const QStringList &ignored_attribs, const QStringList &ignored_tags);
-
 		/*! \brief Copies the non-empty attributes on the map at parameter to the own object attributes map. This method is used
 		as an auxiliary when generating alter definition for some objects. When one or more attributes are copied an especial
 		attribute is inserted (HAS_CHANGES) in order to help the atler generatin process to identify which attributes are
@@ -483,7 +483,8 @@ class __libcore BaseObject {
 				Some key attributes / setters in the base classes BaseObject, BaseTable and BaseRelationship
 				will automatically invalidate the code but for all other setters / attributes the user must call
 				this method explicitly in order to force the regeneration of the code.
-				This method has no effect when the cached code support is disables. See enableCachedCode() */
+				This method has no effect when the cached code support is disables. See enableCachedCode().
+				Regardless of the cached code support, invalidations are always forwarded to the database model of the object */
 		virtual void setCodeInvalidated(bool value);
 
 		virtual void configureSearchAttributes();
@@ -491,10 +492,22 @@ class __libcore BaseObject {
 		//! \brief Returns if the code (sql and xml) is invalidated
 		bool isCodeInvalidated();
 
+		/*! \brief Marks the SQL code of the object as exported to a file. The mark is removed automatically
+				when the code is invalidated. This method has no effect when the cached code support is disabled */
+		void setCodeExported(bool value);
+
+		//! \brief Returns if the SQL code of the object was exported and not invalidated since then
+		bool isCodeExported();
+
 		/*! \brief Compares the xml code between the "this" object and another one. The user can specify which attributes
 		and tags must be ignored when makin the comparison. NOTE: only the name for attributes and tags must be informed */
 		virtual bool isCodeDiffersFrom(BaseObject *object, const QStringList &ignored_attribs={}, const QStringList &ignored_tags={});
 
+		/*! \brief Compares two xml buffers and returns if they differs from each other. The user can specify which attributes
+		and tags must be ignored when makin the comparison. NOTE: only the name for attributes and tags must be informed.
+		Since this method only handles the provided buffers it can be safely called from worker threads */
+		static bool isCodeDiffersFrom(const QString &xml_def1, const QString &xml_def2, const QStringList &ignored_attribs, const QStringList &ignored_tags);
+
 		/*! \brief Enable/disable the use of cached sql/xml code. When enabled the code generation speed is hugely increased
 				but the downward is an increasing on memory usage. Make sure to every time when an attribute of any instance derivated
 				of this class changes you need to call setCodeInvalidated() in order to force the update of the code cache.
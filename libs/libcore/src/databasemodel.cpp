@@ -21,10 +21,14 @@
 #include "defaultlanguages.h"
 #include <QtDebug>
 #include <random>
+#include <set>
+#include <functional>
 #include "utilsns.h"
 
 unsigned DatabaseModel::dbmodel_id=2000;
 
+const QString DatabaseModel::SplitManifestFile("sql_manifest.md5");
+
 DatabaseModel::DatabaseModel()
 {
 	this->model_wgt=nullptr;
@@ -53,6 +57,8 @@ DatabaseModel::DatabaseModel()
 	conn_limit=-1;
 	last_zoom=1;
 	loading_model=invalidated=append_at_eod=prepend_at_bod=false;
+	add_batch_level=0;
+	creation_orders_ver=0;
 	attributes[Attributes::Encoding]="";
 	attributes[Attributes::TemplateDb]="";
 	attributes[Attributes::ConnLimit]="";
@@ -470,10 +476,77 @@ void DatabaseModel::__addObject(BaseObject *object, int obj_idx)
 	}
 
 	object->setDatabase(this);
-	emit s_objectAdded(object);
+	invalidateCreationOrders();
+
+	if(add_batch_level > 0)
+	{
+		BaseGraphicObject *graph_obj = dynamic_cast<BaseGraphicObject *>(object);
+
+		/* Graphical objects in a batch have no graphical representation until the batch ends.
+		 * If some operation requests it before that, the batch is flushed so the object can be
+		 * represented. The direct connection makes the flush run in the thread requesting the
+		 * representation, which may not be the one adding the objects (e.g. the GUI thread while
+		 * the objects are imported in a worker thread), so the batch is guarded by a mutex */
+		if(graph_obj)
+		{
+			graph_obj->setOverlyingObjectDeferred(true);
+			connect(graph_obj, &BaseGraphicObject::s_overlyingObjectRequested, this, &DatabaseModel::flushObjectsAddition, Qt::DirectConnection);
+		}
+
+		add_batch_mutex.lock();
+		added_objs_batch.push_back(object);
+		add_batch_mutex.unlock();
+	}
+	else
+		emit s_objectAdded(object);
+
 	this->setInvalidated(true);
 }
 
+void DatabaseModel::beginObjectsAddition()
+{
+	add_batch_level++;
+}
+
+void DatabaseModel::endObjectsAddition()
+{
+	if(add_batch_level == 0)
+		return;
+
+	add_batch_level--;
+
+	if(add_batch_level == 0)
+		flushObjectsAddition();
+}
+
+void DatabaseModel::flushObjectsAddition()
+{
+	std::vector<BaseObject *> objects;
+	BaseGraphicObject *graph_obj = nullptr;
+
+	/* The pending objects are taken at once so the objects added by other threads
+	 * from now on are held in a new batch, being notified in a next flush */
+	add_batch_mutex.lock();
+	objects.swap(added_objs_batch);
+	add_batch_mutex.unlock();
+
+	if(objects.empty())
+		return;
+
+	for(auto &obj : objects)
+	{
+		graph_obj = dynamic_cast<BaseGraphicObject *>(obj);
+
+		if(graph_obj)
+		{
+			disconnect(graph_obj, &BaseGraphicObject::s_overlyingObjectRequested, this, &DatabaseModel::flushObjectsAddition);
+			graph_obj->setOverlyingObjectDeferred(false);
+		}
+	}
+
+	emit s_objectsAdded(objects);
+}
+
 void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_refs)
 {
 	if(!object)
@@ -529,7 +602,14 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 			}
 
 			if(obj_idx < 0 || obj_idx >= static_cast<int>(obj_list->size()))
-				getObject(object->getSignature(), obj_type, obj_idx);
+			{
+				/* Permissions are located by their addresses avoiding the comparison of
+				 * signatures over the whole permissions list */
+				if(obj_type == ObjectType::Permission)
+					obj_idx = getObjectIndex(object);
+				else
+					getObject(object->getSignature(), obj_type, obj_idx);
+			}
 
 			if(obj_idx >= 0)
 			{
@@ -537,9 +617,36 @@ void DatabaseModel::__removeObject(BaseObject *object, int obj_idx, bool check_r
 					removePermissions(object);
 
 				obj_list->erase(obj_list->begin() + obj_idx);
+				invalidateCreationOrders();
+
+				if(obj_type == ObjectType::Permission)
+					updatePermissionIndex(dynamic_cast<Permission *>(object), true);
 			}
 		}
 
+		//Objects removed before the end of the current batch are not notified as added
+		add_batch_mutex.lock();
+
+		if(!added_objs_batch.empty())
+		{
+			auto itr = std::find(added_objs_batch.begin(), added_objs_batch.end(), object);
+
+			if(itr != added_objs_batch.end())
+			{
+				BaseGraphicObject *graph_obj = dynamic_cast<BaseGraphicObject *>(object);
+
+				if(graph_obj)
+				{
+					disconnect(graph_obj, &BaseGraphicObject::s_overlyingObjectRequested, this, &DatabaseModel::flushObjectsAddition);
+					graph_obj->setOverlyingObjectDeferred(false);
+				}
+
+				added_objs_batch.erase(itr);
+			}
+		}
+
+		add_batch_mutex.unlock();
+
 		object->setDatabase(nullptr);
 		emit s_objectRemoved(object);
 	}
@@ -824,6 +931,9 @@ void DatabaseModel::destroyObjects()
 		delete perm;
 
 	permissions.clear();
+	obj_perms.clear();
+	similar_perms.clear();
+	invalidateCreationOrders();
 
 	for(auto &inv_obj : invalid_special_objs)
 		delete inv_obj;
@@ -1677,13 +1787,6 @@ void DatabaseModel::updateRelsGeneratedObjects()
 
 void DatabaseModel::validateRelationships()
 {
-	Relationship *rel = nullptr;
-	BaseRelationship *base_rel = nullptr;
-	std::vector<Exception> errors;
-	std::map<Relationship *, Exception> rel_errors;
-	std::vector<Relationship *> failed_rels;
-	std::vector<BaseTable *> tabs;
-
 	if(!hasInvalidRelatioships())
 		return;
 
@@ -1691,15 +1794,140 @@ void DatabaseModel::validateRelationships()
 	if(!loading_model && xml_special_objs.empty())
 		storeSpecialObjectsXML();
 
-	// Disconnecting all relationships in order to force the correct propagation of columns/constraints
-	disconnectRelationships();
+	/* The objects recreated during the relationships propagation (special objects, fk relationships)
+	 * are notified at once at the end of the process */
+	beginObjectsAddition();
+
+	try
+	{
+		// Disconnecting all relationships in order to force the correct propagation of columns/constraints
+		disconnectRelationships();
+		reconnectRelationships(false);
+		endObjectsAddition();
+	}
+	catch(Exception &e)
+	{
+		endObjectsAddition();
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+std::vector<Relationship *> DatabaseModel::getSortedRelationships()
+{
+	std::vector<Relationship *> rels, sorted_rels;
+	std::map<BaseTable *, std::vector<unsigned>> rels_by_tab;
+	std::vector<unsigned> in_degree;
+	std::vector<bool> visited;
+	std::set<unsigned> ready_rels;
+	Relationship *rel = nullptr;
+	unsigned idx = 0, next_unvisited = 0;
+
+	for(auto &obj : relationships)
+	{
+		rel = dynamic_cast<Relationship *>(obj);
+		rels.push_back(rel);
+
+		/* Mapping the tables from which the relationship copies columns. Many-to-many relationships
+		 * copies the columns from both tables while the others only from the reference table */
+		if(rel->getRelationshipType() == BaseRelationship::RelationshipNn)
+		{
+			rels_by_tab[rel->getTable(BaseRelationship::SrcTable)].push_back(idx);
+
+			if(!rel->isSelfRelationship())
+				rels_by_tab[rel->getTable(BaseRelationship::DstTable)].push_back(idx);
+		}
+		else
+			rels_by_tab[rel->getReferenceTable()].push_back(idx);
+
+		idx++;
+	}
+
+	in_degree.resize(rels.size(), 0);
+	visited.resize(rels.size(), false);
+
+	/* A relationship depends on all other relationships which receiver table
+	 * is the table from which it copies columns (e.g. parent before children) */
+	for(idx = 0; idx < rels.size(); idx++)
+	{
+		auto itr = rels_by_tab.find(rels[idx]->getReceiverTable());
+
+		if(itr == rels_by_tab.end())
+			continue;
+
+		for(auto &dep_idx : itr->second)
+		{
+			if(dep_idx != idx)
+				in_degree[dep_idx]++;
+		}
+	}
+
+	for(idx = 0; idx < rels.size(); idx++)
+	{
+		if(in_degree[idx] == 0)
+			ready_rels.insert(idx);
+	}
+
+	/* The ready relationships are always processed from the lowest index
+	 * so the creation order is preserved whenever the dependencies allow */
+	while(sorted_rels.size() < rels.size())
+	{
+		/* If there are no ready relationships then we found a cycle, so we pick the first
+		 * unvisited relationship to break it and keep the original order for the ones involved */
+		if(ready_rels.empty())
+		{
+			while(visited[next_unvisited])
+				next_unvisited++;
+
+			ready_rels.insert(next_unvisited);
+		}
+
+		idx = *ready_rels.begin();
+		ready_rels.erase(ready_rels.begin());
+
+		if(visited[idx])
+			continue;
+
+		visited[idx] = true;
+		sorted_rels.push_back(rels[idx]);
+
+		auto itr = rels_by_tab.find(rels[idx]->getReceiverTable());
+
+		if(itr == rels_by_tab.end())
+			continue;
+
+		for(auto &dep_idx : itr->second)
+		{
+			if(dep_idx != idx && !visited[dep_idx] && --in_degree[dep_idx] == 0)
+				ready_rels.insert(dep_idx);
+		}
+	}
+
+	return sorted_rels;
+}
+
+void DatabaseModel::reconnectRelationships(bool single_pass)
+{
+	Relationship *rel = nullptr;
+	BaseRelationship *base_rel = nullptr;
+	std::vector<Exception> errors;
+	std::map<Relationship *, Exception> rel_errors;
+	std::vector<Relationship *> failed_rels, rels;
+	std::vector<BaseTable *> tabs;
+
+	if(single_pass)
+		rels = getSortedRelationships();
+	else
+	{
+		for(auto &rl : relationships)
+			rels.push_back(dynamic_cast<Relationship *>(rl));
+	}
 
-	// Trying to connect all relatinships in the order they were created
-	for(auto &rl : relationships)
+	// Trying to connect all relatinships in the order they were created (or sorted by their dependencies)
+	for(auto &rl : rels)
 	{
 		try
 		{
-			rel = dynamic_cast<Relationship *>(rl);
+			rel = rl;
 			rel->blockSignals(true);
 			rel->connectRelationship();
 			rel->blockSignals(false);
@@ -1711,31 +1939,46 @@ void DatabaseModel::validateRelationships()
 		}
 		catch(Exception &)
 		{
+			rel->blockSignals(false);
 			failed_rels.push_back(rel);
 		}
 	}
 
-	// Trying to recreate relationships that failed to connect previously
-	unsigned idx = 0, max_tries = failed_rels.size();
+	/* Trying to recreate relationships that failed to connect previously. Connecting a relationship
+	 * may allow others that depend on it to be connected too (e.g. chains of relationships involved
+	 * in cycles), so the failed ones are retried while each pass connects at least one of them */
+	bool rels_connected = false;
 
-	while(idx < max_tries)
+	do
 	{
-		for(auto &rel : failed_rels)
+		rels_connected = false;
+
+		for(auto itr = failed_rels.begin(); itr != failed_rels.end();)
 		{
+			rel = *itr;
+
 			try
 			{
 				rel->blockSignals(true);
 				rel->connectRelationship();
 				rel->blockSignals(false);
+
+				tabs.push_back(rel->getTable(Relationship::SrcTable));
+				tabs.push_back(rel->getTable(Relationship::DstTable));
+
+				rel_errors.erase(rel);
+				itr = failed_rels.erase(itr);
+				rels_connected = true;
 			}
 			catch(Exception &e)
 			{
+				rel->blockSignals(false);
 				rel_errors[rel] = e;
+				itr++;
 			}
 		}
-
-		idx++;
 	}
+	while(rels_connected && !failed_rels.empty());
 
 	/* Checking if some failed relationships have generated errors in the connection retry.
 	 * If that's the case, we just remove the relationships from the model since
@@ -2112,7 +2355,9 @@ void DatabaseModel::storeSpecialObjectsXML()
 			tab_obj=dynamic_cast<TableObject *>(permission->getObject());
 			itr++;
 
-			if(tab_obj)
+			/* Only permissions applied to relationship added columns are considered special
+			 * since they are the only ones destroyed when the relationships are disconnected */
+			if(tab_obj && tab_obj->isAddedByRelationship())
 			{
 				xml_special_objs[permission->getObjectId()]=permission->getSourceCode(SchemaParser::XmlCode);
 				removePermission(permission);
@@ -2952,7 +3197,7 @@ void DatabaseModel::addPermission(Permission *perm)
 
 		TableObject *tab_obj=dynamic_cast<TableObject *>(perm->getObject());
 
-		if(getPermissionIndex(perm, false) >=0)
+		if(findPermission(perm, false))
 		{
 			throw Exception(Exception::getErrorMessage(ErrorCode::AsgDuplicatedPermission)
 							.arg(perm->getObject()->getName())
@@ -2971,7 +3216,9 @@ void DatabaseModel::addPermission(Permission *perm)
 							ErrorCode::RefObjectInexistsModel,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 		permissions.push_back(perm);
+		updatePermissionIndex(perm, false);
 		perm->setDatabase(this);
+		invalidateCreationOrders();
 	}
 	catch(Exception &e)
 	{
@@ -2999,128 +3246,145 @@ void DatabaseModel::removePermission(Permission *perm)
 	}
 }
 
-void DatabaseModel::removePermissions(BaseObject *object)
+void DatabaseModel::updatePermissionIndex(Permission *perm, bool remove)
 {
-	std::vector<BaseObject *>::iterator itr, itr_end;
-	Permission *perm=nullptr;
-	unsigned idx=0;
+	if(!perm)
+		return;
+
+	std::vector<Permission *> &perms = obj_perms[perm->getObject()];
+
+	if(remove)
+	{
+		perms.erase(std::remove(perms.begin(), perms.end(), perm), perms.end());
 
+		if(perms.empty())
+			obj_perms.erase(perm->getObject());
+	}
+	else
+		perms.push_back(perm);
+
+	similar_perms.clear();
+}
+
+void DatabaseModel::removePermissions(BaseObject *object)
+{
 	if(!object)
 		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	itr=permissions.begin();
-	itr_end=permissions.end();
+	auto itr = obj_perms.find(object);
 
-	while(itr!=itr_end)
-	{
-		perm=dynamic_cast<Permission *>(*itr);
+	if(itr == obj_perms.end())
+		return;
 
-		if(perm->getObject()==object)
-		{
-			invalid_special_objs.push_back(perm);
+	std::vector<Permission *> rem_perms = itr->second;
 
-			permissions.erase(itr);
-			itr=itr_end=permissions.end();
+	obj_perms.erase(itr);
+	similar_perms.clear();
+	invalidateCreationOrders();
 
-			if(!permissions.empty())
-				itr=permissions.begin() + idx;
-		}
-		else
-		{ itr++; idx++; }
-	}
+	/* Removing all the object's permissions from the list in a single pass
+	 * instead of erasing them one by one */
+	permissions.erase(std::remove_if(permissions.begin(), permissions.end(),
+																	 [&rem_perms](BaseObject *perm){
+		return std::find(rem_perms.begin(), rem_perms.end(), perm) != rem_perms.end();
+	}), permissions.end());
+
+	invalid_special_objs.insert(invalid_special_objs.end(), rem_perms.begin(), rem_perms.end());
 }
 
 void DatabaseModel::getPermissions(BaseObject *object, std::vector<Permission *> &perms)
 {
-	std::vector<BaseObject *>::iterator itr, itr_end;
-	Permission *perm=nullptr;
-
 	if(!object)
 		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	itr=permissions.begin();
-	itr_end=permissions.end();
+	auto itr = obj_perms.find(object);
 
 	perms.clear();
 
-	while(itr!=itr_end)
-	{
-		perm=dynamic_cast<Permission *>(*itr);
-
-		if(perm->getObject()==object)
-			perms.push_back(perm);
-
-		itr++;
-	}
+	if(itr != obj_perms.end())
+		perms = itr->second;
 }
 
-int DatabaseModel::getPermissionIndex(Permission *perm, bool exact_match)
+void DatabaseModel::invalidatePermissionsIndex()
 {
-	int perm_idx=-1;
+	similar_perms.clear();
+}
 
-	if(perm)
-	{
-		Permission *perm_aux=nullptr;
-		std::vector<BaseObject *>::iterator itr, itr_end;
+Permission *DatabaseModel::findPermission(Permission *perm, bool exact_match)
+{
+	if(!perm)
+		return nullptr;
 
-		itr=permissions.begin();
-		itr_end=permissions.end();
+	auto itr = obj_perms.find(perm->getObject());
 
-		if(exact_match)
+	if(exact_match)
+	{
+		/* If the permission's object has permissions in this model we only need
+		 * to compare the provided permission against them */
+		if(itr != obj_perms.end())
 		{
-			while(itr!=itr_end)
+			for(auto &perm_aux : itr->second)
 			{
-				perm_aux=dynamic_cast<Permission *>(*itr);
-
 				if(perm->isSimilarTo(perm_aux))
-				{
-					perm_idx=itr-permissions.begin();
-					break;
-				}
-
-				itr++;
+					return perm_aux;
 			}
+
+			return nullptr;
 		}
-		else
-		{
-			BaseObject *object=nullptr;
-			Role *role=nullptr;
-			unsigned count, i;
-			bool ref_role=false;
 
-			object=perm->getObject();
+		/* The permission's object belongs to another model (e.g. when comparing models)
+		 * so we use the similarity keys index to find a similar permission in this model */
+		if(similar_perms.empty())
+		{
+			Permission *perm_aux = nullptr;
 
-			while(itr!=itr_end)
+			for(auto &obj : permissions)
 			{
-				perm_aux=dynamic_cast<Permission *>(*itr);
+				perm_aux = dynamic_cast<Permission *>(obj);
+				similar_perms.emplace(perm_aux->getSimilarityKey(), perm_aux);
+			}
+		}
 
-				/* When the object of the auxiliary permission is the same as the
-		   specified permission it will be check if the existant roles are
-		   the same on both permissions */
-				if(object==perm_aux->getObject())
-				{
-					count=perm->getRoleCount();
+		auto sim_itr = similar_perms.find(perm->getSimilarityKey());
 
-					for(i=0; i < count && !ref_role; i++)
-					{
-						role=perm->getRole(i);
-						ref_role=perm_aux->isRoleExists(role);
-					}
-				}
+		if(sim_itr != similar_perms.end() && perm->isSimilarTo(sim_itr->second))
+			return sim_itr->second;
 
-				//If the permissions references the same roles but one is a REVOKE and other GRANT they a considered different
-				if(perm==perm_aux || (ref_role && perm->isRevoke()==perm_aux->isRevoke()))
-				{
-					perm_idx=itr-permissions.begin();
-					break;
-				}
+		return nullptr;
+	}
 
-				itr++;
+	if(itr == obj_perms.end())
+		return nullptr;
+
+	for(auto &perm_aux : itr->second)
+	{
+		if(perm == perm_aux)
+			return perm_aux;
+
+		/* When the permissions are applied to the same object we check if
+		 * there're roles in common between them. If the permissions references the same roles
+		 * but one is a REVOKE and other GRANT they a considered different */
+		if(perm->isRevoke() == perm_aux->isRevoke())
+		{
+			for(auto &role : perm->getRoles())
+			{
+				if(perm_aux->isRoleExists(role))
+					return perm_aux;
 			}
 		}
 	}
 
-	return perm_idx;
+	return nullptr;
+}
+
+int DatabaseModel::getPermissionIndex(Permission *perm, bool exact_match)
+{
+	Permission *perm_aux = findPermission(perm, exact_match);
+
+	if(!perm_aux)
+		return -1;
+
+	return std::find(permissions.begin(), permissions.end(), perm_aux) - permissions.begin();
 }
 
 BaseObject *DatabaseModel::getObject(const QString &name, ObjectType obj_type)
@@ -3185,7 +3449,345 @@ void DatabaseModel::configureDatabase(attribs_map &attribs)
 	setBasicAttributes(this);
 }
 
-void DatabaseModel::loadModel(const QString &filename)
+std::set<const xmlNode *> DatabaseModel::getFilteredElements(const QStringList &filters, const QString &search_attr, const QStringList &extra_refs)
+{
+	struct ElemFilter {
+		ObjectType obj_type;
+		QRegularExpression regexp;
+		QString pattern;
+	};
+
+	struct ElemInfo {
+		const xmlNode *elem;
+		ObjectType obj_type;
+
+		//! \brief The names used to match the element (and its table children) against the filters
+		std::vector<std::pair<ObjectType, QString>> match_names;
+
+		//! \brief The names of the objects referenced by the element and its children
+		QStringList ref_names;
+
+		/*! \brief The names of the objects completed by a dependent element (e.g. the tables connected by a relationship).
+		 * The dependent element is selected only when all of them are selected */
+		QStringList owner_names;
+	};
+
+	/* Objects in which the signature carries more than the schema qualified name (e.g. the parameters of a function).
+	 * These ones are matched against signature filters in a relaxed way since their complete signatures can't be
+	 * determined without creating them, so more objects than needed may be loaded but never less */
+	static const std::vector<ObjectType> arg_sign_types = {
+		ObjectType::Function, ObjectType::Procedure, ObjectType::Aggregate, ObjectType::Operator,
+		ObjectType::OpClass, ObjectType::OpFamily, ObjectType::Cast, ObjectType::Transform
+	};
+
+	// Objects that complete the ones they reference so they are selected together with them
+	static const std::vector<ObjectType> dependent_types = {
+		ObjectType::Relationship, ObjectType::BaseRelationship, ObjectType::Permission,
+		ObjectType::Index, ObjectType::Trigger, ObjectType::Rule, ObjectType::Policy
+	};
+
+	static const QRegularExpression sign_args_regexp("(\\(|( USING )).*$");
+
+	static const QStringList ref_attribs = { Attributes::Table, Attributes::SrcTable, Attributes::DstTable,
+																					 Attributes::RefTable, Attributes::Sequence };
+
+	QStringList values, modes = { UtilsNs::FilterWildcard, UtilsNs::FilterRegExp };
+	std::vector<ElemFilter> elem_filters;
+	std::vector<ElemInfo> elems;
+	std::map<QString, std::vector<size_t>> providers;
+	std::vector<bool> selected;
+	std::vector<size_t> pending;
+	std::set<const xmlNode *> sel_elems;
+	std::function<void(ElemInfo &, const QString &)> collect_refs;
+	attribs_map attribs, sch_attribs;
+	QString name, sch_name;
+	bool use_signature = search_attr == Attributes::Signature;
+
+	auto normalize_ref = [](QString ref) {
+		return ref.remove('"').remove(sign_args_regexp).trimmed();
+	};
+
+	// Parsing the filters the same way as findObjects() does
+	for(auto &filter : filters)
+	{
+		ElemFilter elem_flt;
+
+		values = filter.split(UtilsNs::FilterSeparator);
+
+		if(values.size() == 3)
+		{
+			elem_flt.obj_type = BaseObject::getObjectType(values[0]);
+			elem_flt.pattern = values[1];
+		}
+
+		if(values.size() != 3 || elem_flt.obj_type == ObjectType::BaseObject ||
+			 elem_flt.pattern.isEmpty() || !modes.contains(values[2]))
+		{
+			throw Exception(Exception::getErrorMessage(ErrorCode::InvalidObjectFilter).arg(filter).arg(modes.join('|')),
+											ErrorCode::InvalidObjectFilter,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+		}
+
+		elem_flt.regexp.setPatternOptions(QRegularExpression::CaseInsensitiveOption);
+
+		if(values[2] == UtilsNs::FilterRegExp)
+			elem_flt.regexp.setPattern(elem_flt.pattern);
+		else
+			elem_flt.regexp.setPattern(QRegularExpression::wildcardToRegularExpression(elem_flt.pattern));
+
+		elem_flt.pattern.remove('"');
+		elem_filters.push_back(elem_flt);
+	}
+
+	// Collects the names of the objects referenced by the current element, its siblings and their descendants
+	collect_refs = [&](ElemInfo &info, const QString &parent_name) {
+		attribs_map elem_attribs;
+		ObjectType obj_type;
+		QString tag;
+
+		do
+		{
+			if(xmlparser.getElementType() != XML_ELEMENT_NODE)
+				continue;
+
+			tag = xmlparser.getElementName();
+			obj_type = BaseObject::getObjectType(tag);
+			xmlparser.getElementAttributes(elem_attribs);
+
+			// Table children declared inside the parent's element can be matched by the filters too
+			if(TableObject::isTableObject(obj_type))
+			{
+				info.match_names.push_back({ obj_type, use_signature ?
+																		 parent_name + "." + elem_attribs[Attributes::Name].remove('"') :
+																		 elem_attribs[Attributes::Name] });
+			}
+			else if(tag == Attributes::Object ||
+							(obj_type != ObjectType::BaseObject && obj_type != ObjectType::Parameter &&
+							 obj_type != ObjectType::TypeAttribute))
+			{
+				info.ref_names.append(normalize_ref(elem_attribs[Attributes::Name]));
+				info.ref_names.append(normalize_ref(elem_attribs[Attributes::Signature]));
+
+				// A permission completes the object it's applied to (or the table, in case of column permissions)
+				if(info.obj_type == ObjectType::Permission && tag == Attributes::Object)
+				{
+					info.owner_names.append(normalize_ref(!elem_attribs[Attributes::Parent].isEmpty() ?
+																								elem_attribs[Attributes::Parent] : elem_attribs[Attributes::Name]));
+				}
+			}
+			else if(tag == Attributes::Roles)
+			{
+				for(auto &role_name : elem_attribs[Attributes::Names].split(',', Qt::SkipEmptyParts))
+					info.ref_names.append(normalize_ref(role_name));
+			}
+			// Tables used by view expressions are referenced by <reftable name="..."/> elements
+			else if(tag == Attributes::RefTableTag)
+				info.ref_names.append(normalize_ref(elem_attribs[Attributes::Name]));
+
+			for(auto &attr : ref_attribs)
+				info.ref_names.append(normalize_ref(elem_attribs[attr]));
+
+			// The column owning a sequence is referenced as [schema].[table].[column] so we keep only the table
+			if(!elem_attribs[Attributes::OwnerColumn].isEmpty())
+				info.ref_names.append(normalize_ref(elem_attribs[Attributes::OwnerColumn].section('.', 0, -2)));
+
+			xmlparser.savePosition();
+
+			if(xmlparser.accessElement(XmlParser::ChildElement))
+				collect_refs(info, parent_name);
+
+			xmlparser.restorePosition();
+		}
+		while(xmlparser.accessElement(XmlParser::NextElement));
+	};
+
+	xmlparser.savePosition();
+
+	if(xmlparser.accessElement(XmlParser::ChildElement))
+	{
+		do
+		{
+			if(xmlparser.getElementType() != XML_ELEMENT_NODE ||
+				 xmlparser.getElementName() == Attributes::Changelog)
+				continue;
+
+			ElemInfo info;
+
+			info.elem = xmlparser.getCurrentElement();
+			info.obj_type = BaseObject::getObjectType(xmlparser.getElementName());
+			xmlparser.getElementAttributes(attribs);
+			name = QString(attribs[Attributes::Name]).remove('"');
+			sch_name.clear();
+
+			// The schema of the object is declared in the first <schema> child element
+			xmlparser.savePosition();
+
+			if(info.obj_type != ObjectType::Schema && xmlparser.accessElement(XmlParser::ChildElement))
+			{
+				do
+				{
+					if(xmlparser.getElementType() == XML_ELEMENT_NODE &&
+						 xmlparser.getElementName() == Attributes::Schema)
+					{
+						xmlparser.getElementAttributes(sch_attribs);
+						sch_name = sch_attribs[Attributes::Name].remove('"');
+						break;
+					}
+				}
+				while(xmlparser.accessElement(XmlParser::NextElement));
+			}
+
+			xmlparser.restorePosition();
+
+			if(!sch_name.isEmpty())
+				name.prepend(sch_name + ".");
+
+			info.match_names.push_back({ info.obj_type, use_signature ? name : attribs[Attributes::Name] });
+
+			if(std::find(dependent_types.begin(), dependent_types.end(), info.obj_type) == dependent_types.end() &&
+				 !TableObject::isTableObject(info.obj_type))
+			{
+				providers[name].push_back(elems.size());
+
+				// Some objects (e.g. extensions) can also be referenced without their schema names
+				if(!sch_name.isEmpty())
+					providers[name.section('.', 1)].push_back(elems.size());
+			}
+
+			xmlparser.savePosition();
+
+			if(xmlparser.accessElement(XmlParser::ChildElement))
+				collect_refs(info, name);
+
+			xmlparser.restorePosition();
+
+			// Table level references are made in the element itself (e.g. <index table="...">)
+			for(auto &attr : ref_attribs)
+				info.ref_names.append(normalize_ref(attribs[attr]));
+
+			/* A relationship completes both tables it connects, except for inheritance, partitioning and copy
+			 * relationships, which complete only the child table (source) since it depends on the parent one */
+			if(info.obj_type == ObjectType::Relationship || info.obj_type == ObjectType::BaseRelationship)
+			{
+				info.owner_names.append(normalize_ref(attribs[Attributes::SrcTable]));
+
+				if(attribs[Attributes::Type] != Attributes::RelationshipGen &&
+					 attribs[Attributes::Type] != Attributes::RelationshipDep &&
+					 attribs[Attributes::Type] != Attributes::RelationshipPart)
+					info.owner_names.append(normalize_ref(attribs[Attributes::DstTable]));
+			}
+			else if(info.obj_type != ObjectType::Permission)
+				info.owner_names.append(normalize_ref(attribs[Attributes::Table]));
+
+			info.owner_names.removeAll("");
+
+			info.ref_names.removeAll("");
+			info.ref_names.removeDuplicates();
+			elems.push_back(info);
+		}
+		while(xmlparser.accessElement(XmlParser::NextElement));
+	}
+
+	xmlparser.restorePosition();
+	selected.resize(elems.size(), false);
+
+	auto select_elem = [&](size_t idx) {
+		if(!selected[idx])
+		{
+			selected[idx] = true;
+			pending.push_back(idx);
+		}
+	};
+
+	auto is_ref_selected = [&](const QString &ref_name) {
+		auto itr = providers.find(ref_name);
+
+		return itr != providers.end() &&
+					 std::any_of(itr->second.begin(), itr->second.end(), [&selected](size_t prov_idx){ return selected[prov_idx]; });
+	};
+
+	auto select_providers = [&](const QString &ref_name) {
+		auto itr = providers.find(ref_name);
+
+		if(itr != providers.end())
+		{
+			for(auto &idx : itr->second)
+				select_elem(idx);
+		}
+	};
+
+	// Selecting the elements matching the filters as well as the database and the required objects
+	for(size_t idx = 0; idx < elems.size(); idx++)
+	{
+		ElemInfo &info = elems[idx];
+
+		if(info.obj_type == ObjectType::Database)
+		{
+			select_elem(idx);
+			continue;
+		}
+
+		for(auto &elem_flt : elem_filters)
+		{
+			for(auto &[obj_type, match_name] : info.match_names)
+			{
+				if(obj_type != elem_flt.obj_type)
+					continue;
+
+				if(elem_flt.regexp.match(match_name).hasMatch() ||
+					 (use_signature && std::find(arg_sign_types.begin(), arg_sign_types.end(), obj_type) != arg_sign_types.end() &&
+						elem_flt.pattern.contains(match_name.section('.', -1), Qt::CaseInsensitive)))
+				{
+					select_elem(idx);
+					break;
+				}
+			}
+
+			if(selected[idx])
+				break;
+		}
+	}
+
+	for(auto &ref_name : extra_refs)
+		select_providers(normalize_ref(ref_name));
+
+	/* Selecting recursively the dependencies of the selected elements. Once no more dependencies
+	 * are found we select the elements that complete the selected ones (e.g. relationships connected to
+	 * selected tables) and repeat the process until there's nothing else to be selected. A dependent element
+	 * is selected only when all the objects it completes are selected, otherwise a single relationship
+	 * would pull in all the tables connected to the selected ones */
+	while(!pending.empty())
+	{
+		while(!pending.empty())
+		{
+			size_t idx = pending.back();
+			pending.pop_back();
+
+			for(auto &ref_name : elems[idx].ref_names)
+				select_providers(ref_name);
+		}
+
+		for(size_t idx = 0; idx < elems.size(); idx++)
+		{
+			if(selected[idx] ||
+				 std::find(dependent_types.begin(), dependent_types.end(), elems[idx].obj_type) == dependent_types.end())
+				continue;
+
+			if(!elems[idx].owner_names.isEmpty() &&
+				 std::all_of(elems[idx].owner_names.begin(), elems[idx].owner_names.end(), is_ref_selected))
+				select_elem(idx);
+		}
+	}
+
+	for(size_t idx = 0; idx < elems.size(); idx++)
+	{
+		if(selected[idx])
+			sel_elems.insert(elems[idx].elem);
+	}
+
+	return sel_elems;
+}
+
+void DatabaseModel::loadModel(const QString &filename, const QStringList &filters, const QString &search_attr)
 {
 	if(!filename.isEmpty())
 	{
@@ -3196,6 +3798,8 @@ void DatabaseModel::loadModel(const QString &filename)
 		bool protected_model=false; //, found_inh_rel = false;
 		QStringList pos_str;
 		std::map<ObjectType, QString> def_objs;
+		std::set<const xmlNode *> sel_elems;
+		bool filter_elems = !filters.isEmpty();
 
 		//Configuring the path to the base path for objects DTD
 		dtd_file=GlobalAttributes::getSchemasRootPath() +
@@ -3311,6 +3915,22 @@ void DatabaseModel::loadModel(const QString &filename)
 			def_objs[ObjectType::Collation]=attribs[Attributes::DefaultCollation];
 			def_objs[ObjectType::Tablespace]=attribs[Attributes::DefaultTablespace];
 
+			/* When loading a filtered model we determine in advance the elements that
+			 * must be created (the matching ones and their dependencies), the others are skipped */
+			if(filter_elems)
+			{
+				QStringList def_names;
+
+				for(auto &itr : def_objs)
+					def_names.append(itr.second);
+
+				sel_elems = getFilteredElements(filters, search_attr, def_names);
+			}
+
+			/* Extracting the attributes of the next elements in a separated thread
+			 * while the objects are created from the current ones */
+			xmlparser.startAttributesPrefetch();
+
 			if(xmlparser.accessElement(XmlParser::ChildElement))
 			{
 				do
@@ -3345,7 +3965,7 @@ void DatabaseModel::loadModel(const QString &filename)
 							xmlparser.getElementAttributes(attribs);
 							configureDatabase(attribs);
 						}
-						else
+						else if(!filter_elems || sel_elems.count(xmlparser.getCurrentElement()))
 						{
 							try
 							{
@@ -3384,6 +4004,7 @@ void DatabaseModel::loadModel(const QString &filename)
 				while(xmlparser.accessElement(XmlParser::NextElement));
 			}
 
+			xmlparser.stopAttributesPrefetch();
 			this->BaseObject::setProtected(protected_model);
 
 			//Validating default objects
@@ -3415,7 +4036,10 @@ void DatabaseModel::loadModel(const QString &filename)
 				emit s_objectLoaded(100, tr("Validating relationships..."), enum_t(ObjectType::Relationship));
 				storeSpecialObjectsXML();
 				disconnectRelationships();
-				validateRelationships();
+
+				/* Since all relationships were just disconnected and the special objects stored
+				 * they are reconnected once following their dependencies (parents before children) */
+				reconnectRelationships(true);
 			}
 
 			this->setInvalidated(false);
@@ -3436,6 +4060,7 @@ void DatabaseModel::loadModel(const QString &filename)
 		{
 			QString extra_info;
 			loading_model=false;
+			xmlparser.stopAttributesPrefetch();
 
 			if(xmlparser.getCurrentElement())
 				extra_info=QString(QObject::tr("%1 (line: %2)")).arg(xmlparser.getLoadedFilename()).arg(xmlparser.getCurrentElement()->line);
@@ -7753,7 +8378,66 @@ void DatabaseModel::setDatabaseModelAttributes(attribs_map &attribs, SchemaParse
 	}
 }
 
+void DatabaseModel::invalidateCreationOrders()
+{
+	creation_orders_mutex.lock();
+	creation_orders.clear();
+	creation_orders_ver++;
+	creation_orders_mutex.unlock();
+}
+
+void DatabaseModel::setCodeInvalidated(bool value)
+{
+	if(value)
+	{
+		invalidateCreationOrders();
+		invalidatePermissionsIndex();
+	}
+
+	BaseObject::setCodeInvalidated(value);
+}
+
 std::map<unsigned, BaseObject *> DatabaseModel::getCreationOrder(SchemaParser::CodeType def_type, bool incl_relnn_objs, bool incl_rel1n_constrs)
+{
+	std::map<unsigned, BaseObject *> objs_order;
+	unsigned order_key = 0, order_ver = 0;
+	bool cached = false;
+
+	// The inclusion flags are considered only when generating SQL code
+	if(def_type == SchemaParser::SqlCode)
+		order_key = 1 | (incl_relnn_objs ? 2 : 0) | (incl_rel1n_constrs ? 4 : 0);
+
+	creation_orders_mutex.lock();
+
+	auto itr = creation_orders.find(order_key);
+
+	if(itr != creation_orders.end())
+	{
+		objs_order = itr->second;
+		cached = true;
+	}
+
+	order_ver = creation_orders_ver;
+	creation_orders_mutex.unlock();
+
+	if(cached)
+		return objs_order;
+
+	/* The order is determined without holding the lock since its calculation can change objects
+	 * and, consequently, invalidate the cache. In that case the result is not stored */
+	objs_order = __getCreationOrder(def_type, incl_relnn_objs, incl_rel1n_constrs);
+
+	creation_orders_mutex.lock();
+
+	if(order_ver == creation_orders_ver)
+		creation_orders[order_key] = objs_order;
+
+	creation_orders_mutex.unlock();
+
+	return objs_order;
+}
+
+std::map<unsigned, BaseObject *> DatabaseModel::__getCreationOrder(SchemaParser::CodeType def_type, bool incl_relnn_objs, bool incl_rel1n_constrs)
 {
 	BaseObject *object=nullptr;
 	std::vector<BaseObject *> fkeys, fk_rels, aux_tables;
@@ -8211,14 +8895,73 @@ bool DatabaseModel::saveSplitCustomSQL(bool save_appended, const QString &path,
 	if(!buffer.isEmpty())
 	{
 		emit s_objectLoaded(!save_appended ? 0 : 100, msg, enum_t(ObjectType::Database));
-		UtilsNs::saveFile(path + GlobalAttributes::DirSeparator + filename, buffer);
+		saveSplitFile(path, filename, buffer);
 		return true;
 	}
 
 	return false;
 }
 
-void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code_gen_mode)
+void DatabaseModel::saveSplitFile(const QString &path, const QString &filename, const QByteArray &buffer)
+{
+	QString hash = QCryptographicHash::hash(buffer, QCryptographicHash::Md5).toHex(),
+			file = path + GlobalAttributes::DirSeparator + filename;
+	auto itr = prev_split_hashes.find(filename);
+
+	split_hashes[filename] = hash;
+
+	/* The file is kept untouched if its contents didn't change since the previous incremental export
+	 * (the file on disk is checked since it may have been changed after the previous export) */
+	if(itr != prev_split_hashes.end() && itr->second == hash && isSplitFileIntact(file, hash, buffer.size()))
+		return;
+
+	/* If the contents were saved by the previous export in a file with another name (e.g. an object created before
+	 * this one shifted its creation order index) we just rename that file, as long as it's not part of the current export */
+	if(!QFileInfo::exists(file))
+	{
+		auto range = prev_split_files.equal_range(hash);
+		QString prev_file;
+
+		for(auto prev_itr = range.first; prev_itr != range.second; prev_itr++)
+		{
+			prev_file = path + GlobalAttributes::DirSeparator + prev_itr->second;
+
+			if(split_hashes.count(prev_itr->second) == 0 &&
+				 isSplitFileIntact(prev_file, hash, buffer.size()) && QFile::rename(prev_file, file))
+			{
+				prev_split_files.erase(prev_itr);
+				return;
+			}
+		}
+	}
+
+	UtilsNs::saveFile(file, buffer);
+}
+
+bool DatabaseModel::reuseSplitFile(const QString &path, const QString &filename, const QString &hash)
+{
+	auto itr = prev_split_hashes.find(filename);
+
+	if(itr == prev_split_hashes.end() || itr->second != hash ||
+		 !isSplitFileIntact(path + GlobalAttributes::DirSeparator + filename, hash))
+		return false;
+
+	split_hashes[filename] = hash;
+	return true;
+}
+
+bool DatabaseModel::isSplitFileIntact(const QString &file, const QString &hash, qint64 size)
+{
+	QFile input(file);
+	QCryptographicHash file_hash(QCryptographicHash::Md5);
+
+	if((size >= 0 && input.size() != size) || !input.open(QFile::ReadOnly) || !file_hash.addData(&input))
+		return false;
+
+	return file_hash.result().toHex() == hash;
+}
+
+void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code_gen_mode, bool incremental)
 {
 	QFileInfo fi(path);
 	QDir dir;
@@ -8235,22 +8978,56 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 		dir.mkdir(path);
 
 	QFile output;
+	QString manifest_file = path + GlobalAttributes::DirSeparator + SplitManifestFile;
 	QByteArray buffer;
 	std::map<unsigned, BaseObject *> objects = getCreationOrder(SchemaParser::SqlCode);
 	int pad_size = QString::number(objects.size()).size(), idx = 1;
-	QString filename, name, shell_types;
-	BaseObject *obj = nullptr;
+	QString filename, name, shell_types, hash;
+	BaseObject *obj = nullptr, *file_obj = nullptr;
 	Relationship *rel = nullptr;
 	QStringList sch_names;
 	QRegularExpression name_fmt_regexp("(?!\\-)(\\W)");
 	unsigned 	gen_defs_idx = 0, general_obj_cnt = 0;
 	attribs_map attribs;
+	std::map<unsigned, QString> exported_hashes;
+	bool reuse_code = incremental && code_gen_mode == OriginalSql;
 
 	try
 	{
 		cancel_saving = false;
 		general_obj_cnt = objects.size();
 		shell_types = configureShellTypes(false);
+		split_hashes.clear();
+		prev_split_hashes.clear();
+		prev_split_files.clear();
+
+		// The hashes of the previous export can't be used if the code is now generated for another PostgreSQL version
+		if(reuse_code && exported_code_ver != BaseObject::getPgSQLVersion())
+			exported_code_hashes.clear();
+
+		/* The files described by an existing manifest will be overwritten in a non incremental export,
+		 * so the manifest is removed to avoid a next incremental export to rely on it */
+		if(!incremental && QFileInfo::exists(manifest_file))
+			QFile::remove(manifest_file);
+
+		/* In incremental mode we load the hashes of the files generated by the previous export.
+		 * Each line of the manifest is in the form: [md5 hash]  [file name] */
+		if(incremental && QFileInfo::exists(manifest_file))
+		{
+			QStringList values;
+
+			for(auto &line : QString(UtilsNs::loadFile(manifest_file)).split('\n', Qt::SkipEmptyParts))
+			{
+				values = line.split("  ");
+
+				// Entries pointing to files outside the output directory are ignored
+				if(values.size() == 2 && QFileInfo(values[1].trimmed()).fileName() == values[1].trimmed())
+				{
+					prev_split_hashes[values[1].trimmed()] = values[0].trimmed();
+					prev_split_files.insert({ values[0].trimmed(), values[1].trimmed() });
+				}
+			}
+		}
 
 		/* We try to save prepended code as the first script. In case of success increment the script index
 		 * to keep generating the other scripts in the right order */
@@ -8286,16 +9063,26 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 									enum_t(ObjectType::Type));
 
 				buffer.append(shell_types.toUtf8());
-				UtilsNs::saveFile(path + GlobalAttributes::DirSeparator + filename, buffer);
+				saveSplitFile(path, filename, buffer);
 				buffer.clear();
 				shell_types.clear();
 			}
 
-			buffer.append(getSQLDefinition(obj, code_gen_mode).toUtf8());
+			/* In incremental mode the code of the objects not invalidated since the last export of the model is not generated again.
+			 * Instead, the hash of the code written in that export is used to check if the existing file can be reused */
+			hash.clear();
 
-			if(buffer.isEmpty())
-				continue;
+			if(reuse_code && obj != this && obj->isCodeExported() && exported_code_hashes.count(obj->getObjectId()))
+				hash = exported_code_hashes[obj->getObjectId()];
+			else
+			{
+				buffer.append(getSQLDefinition(obj, code_gen_mode).toUtf8());
 
+				if(buffer.isEmpty())
+					continue;
+			}
+
+			file_obj = obj;
 			rel = dynamic_cast<Relationship *>(obj);
 			/* If the object is a 1-1, 1-n or n-n relationship we name the output file
 			 * after the generated table or foreign key in order to avoid to generate
@@ -8306,14 +9093,14 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 					rel->getRelationshipType() == BaseRelationship::RelationshipNn))
 			{
 				if(rel->getGeneratedTable())
-					obj = rel->getGeneratedTable();
+					file_obj = rel->getGeneratedTable();
 				else
 				{
 					for(auto &constr : rel->getGeneratedConstraints())
 					{
 						if(constr->getConstraintType() == ConstraintType::ForeignKey)
 						{
-							obj = constr;
+							file_obj = constr;
 							break;
 						}
 					}
@@ -8326,27 +9113,41 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 			 * the filename in some filesystems. The internal id is used for desambiguation purposes. */
 
 			// If the object is a table child object we use its signature instead of name
-			if(TableObject::isTableObject(obj->getObjectType()))
-				name = dynamic_cast<TableObject *>(obj)->TableObject::getSignature(true);
+			if(TableObject::isTableObject(file_obj->getObjectType()))
+				name = dynamic_cast<TableObject *>(file_obj)->TableObject::getSignature(true);
 			else
-				name = obj->getName(true);
+				name = file_obj->getName(true);
 
 			name.replace('"', "").replace(name_fmt_regexp, "_");
 
 			filename = QString("%1_%2_%3_%4.sql")
 								 .arg(QString::number(idx++).rightJustified(pad_size, '0'))
 								 .arg(name)
-								 .arg(obj->getSchemaName())
-								 .arg(obj->getObjectId());
+								 .arg(file_obj->getSchemaName())
+								 .arg(file_obj->getObjectId());
 
 			emit s_objectLoaded((gen_defs_idx/static_cast<double>(general_obj_cnt)) * 100,
 								tr("Saving SQL of `%1' (%2) to file `%3'.")
-								.arg(obj->getName())
-								.arg(obj->getTypeName())
+								.arg(file_obj->getName())
+								.arg(file_obj->getTypeName())
 								.arg(filename),
-								enum_t(obj->getObjectType()));
+								enum_t(file_obj->getObjectType()));
+
+			// When the previous file can't be reused the code of the object is generated and saved as usual
+			if(hash.isEmpty() || !reuseSplitFile(path, filename, hash))
+			{
+				if(buffer.isEmpty())
+					buffer.append(getSQLDefinition(obj, code_gen_mode).toUtf8());
+
+				saveSplitFile(path, filename, buffer);
+			}
+
+			if(reuse_code && obj != this)
+			{
+				exported_hashes[obj->getObjectId()] = split_hashes[filename];
+				obj->setCodeExported(true);
+			}
 
-			UtilsNs::saveFile(path + GlobalAttributes::DirSeparator + filename, buffer);
 			buffer.clear();
 
 			/* If the current object is the database itself, we need to save the sessionopts
@@ -8365,7 +9166,7 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 														enum_t(ObjectType::Database));
 
 				buffer.append(schparser.getSourceCode(Attributes::SessionOpts, attribs, SchemaParser::SqlCode).toUtf8());
-				UtilsNs::saveFile( path + GlobalAttributes::DirSeparator + filename, buffer);
+				saveSplitFile(path, filename, buffer);
 				buffer.clear();
 			}
 		}
@@ -8373,6 +9174,36 @@ void DatabaseModel::saveSplitSQLDefinition(const QString &path, CodeGenMode code
 		// Saving the prepended sql file
 		saveSplitCustomSQL(true, path, QString::number(idx).rightJustified(pad_size, '0'));
 		configureShellTypes(true);
+
+		/* Once the incremental export finishes we remove the files of the previous export that were not generated
+		 * this time (e.g. removed objects or objects which creation order changed) and update the manifest */
+		if(incremental && !cancel_saving)
+		{
+			for(auto &itr : prev_split_hashes)
+			{
+				if(split_hashes.count(itr.first) == 0)
+					QFile::remove(path + GlobalAttributes::DirSeparator + itr.first);
+			}
+
+			for(auto &itr : split_hashes)
+				buffer.append(QString("%1  %2\n").arg(itr.second, itr.first).toUtf8());
+
+			UtilsNs::saveFile(manifest_file, buffer);
+			buffer.clear();
+
+			if(reuse_code)
+			{
+				exported_code_hashes.swap(exported_hashes);
+				exported_code_ver = BaseObject::getPgSQLVersion();
+			}
+		}
+		// A cancelled export leaves the directory in a state that the manifest doesn't describe anymore
+		else if(incremental && QFileInfo::exists(manifest_file))
+			QFile::remove(manifest_file);
+
+		split_hashes.clear();
+		prev_split_hashes.clear();
+		prev_split_files.clear();
 	}
 	catch (Exception &e)
 	{
@@ -10302,26 +11133,22 @@ void DatabaseModel::getObjectReferences(BaseObject *object, std::vector<BaseObje
 	if(!object)
 		return;
 
-	std::vector<BaseObject *>::iterator itr_perm, itr_perm_end;
 	ObjectType obj_type=object->getObjectType();
 	bool refer=false;
-	Permission *perm=nullptr;
 
 	if(!exclude_perms)
 	{
 		//Get the permissions thata references the object
-		itr_perm=permissions.begin();
-		itr_perm_end=permissions.end();
+		auto itr_perm = obj_perms.find(object);
 
-		while(itr_perm!=itr_perm_end && (!exclusion_mode || (exclusion_mode && !refer)))
+		if(itr_perm != obj_perms.end())
 		{
-			perm=dynamic_cast<Permission *>(*itr_perm);
-			if(perm->getObject()==object)
-			{
-				refer=true;
-				refs.push_back(perm);
-			}
-			itr_perm++;
+			refer = true;
+
+			if(exclusion_mode)
+				refs.push_back(itr_perm->second.front());
+			else
+				refs.insert(refs.end(), itr_perm->second.begin(), itr_perm->second.end());
 		}
 	}
 
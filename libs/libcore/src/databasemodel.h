@@ -31,6 +31,7 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include <QObject>
 #include <QStringList>
 #include <QDateTime>
+#include <QMutex>
 #include "baseobject.h"
 #include "table.h"
 #include "function.h"
@@ -62,6 +63,8 @@ Additionally, this class, saves, loads and generates the XML/SQL definition of a
 #include "transform.h"
 #include "procedure.h"
 #include <algorithm>
+#include <unordered_map>
+#include <set>
 #include <locale.h>
 #include "operation.h"
 
@@ -118,6 +121,22 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Stores the model widget that is managing this database model instance
 		ModelWidget *model_wgt;
 
+		//! \brief Nesting level of the objects addition batch (see beginObjectsAddition())
+		unsigned add_batch_level;
+
+		//! \brief Objects added while a batch is active which are notified at once via s_objectsAdded()
+		std::vector<BaseObject *> added_objs_batch;
+
+		/*! \brief Guards the objects in the current batch since the batch can be flushed from a thread other than
+		 *  the one adding the objects (see flushObjectsAddition()) */
+		QMutex add_batch_mutex;
+
+		/*! \brief Emits s_objectsAdded() for the objects added in the current batch, clearing it.
+		 *  This is also called when the graphical representation of a batched object is
+		 *  requested before the end of the batch (see BaseGraphicObject::getOverlyingObject()).
+		 *  In that case, the method runs in the thread requesting the representation */
+		void flushObjectsAddition();
+
 		//! \brief Database encoding
 		EncodingType encoding;
 
@@ -186,6 +205,43 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		transforms,
 		procedures;
 
+		/*! \brief Stores the permissions grouped by the object they are applied to.
+		 * This map is used to retrieve, remove and check duplicated permissions without scanning the whole permissions list */
+		std::unordered_map<BaseObject *, std::vector<Permission *>> obj_perms;
+
+		/*! \brief Stores the permissions indexed by their similarity keys (see Permission::getSimilarityKey()).
+		 * This map is lazily built by findPermission() when searching for an exact match of a permission
+		 * that belongs to another model (e.g. during diff) and it's discarded whenever a permission is added or removed
+		 * or when invalidatePermissionsIndex() is called */
+		std::unordered_map<QString, Permission *> similar_perms;
+
+		/*! \brief Stores the creation orders already computed by getCreationOrder() indexed by the code type
+		 * and the inclusion flags passed to that method. The cache is discarded whenever an object is added to or removed
+		 * from the model and when the code of any of the model's objects is invalidated (see setCodeInvalidated()) */
+		std::map<unsigned, std::map<unsigned, BaseObject *>> creation_orders;
+
+		//! \brief Incremented each time the cached creation orders are discarded
+		unsigned creation_orders_ver;
+
+		//! \brief Guards the cached creation orders since they can be requested by several threads (e.g. during diff)
+		QMutex creation_orders_mutex;
+
+		/*! \brief Stores the MD5 hashes of the files written by the running split SQL export (split_hashes) and
+		 * the ones read from the manifest of the previous incremental export (prev_split_hashes), both indexed by file name */
+		attribs_map split_hashes, prev_split_hashes;
+
+		/*! \brief Stores the file names of the previous incremental export indexed by their hashes. This is used to reuse
+		 * (rename) a file in which contents moved to another name (e.g. the creation order index of the object changed) */
+		std::multimap<QString, QString> prev_split_files;
+
+		/*! \brief Stores the MD5 hashes of the SQL code written by the last incremental split export indexed by the objects' ids.
+		 * Objects which code wasn't invalidated since then (see BaseObject::isCodeExported()) reuse these hashes in the next
+		 * incremental export so their code isn't generated again */
+		std::map<unsigned, QString> exported_code_hashes;
+
+		//! \brief The PostgreSQL version used by the last incremental split export
+		QString exported_code_ver;
+
 		/*! \brief Stores the xml definition for special objects. This map is used
 		 when revalidating the relationships */
 		std::map<unsigned, QString> xml_special_objs;
@@ -212,6 +268,9 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 
 		double last_zoom;
 
+		//! \brief Registers (or unregisters if remove is true) the permission in the internal permission indexes
+		void updatePermissionIndex(Permission *perm, bool remove);
+
 		//! \brief Returns an object seaching it by its name and type. The third parameter stores the object index
 		BaseObject *getObject(const QString &name, ObjectType obj_type, int &obj_idx);
 
@@ -245,6 +304,14 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		 * calling this method, the user is obligated to call the methdo setObjectsModified() to force the graphical objects rendering. */
 		void setLoadingModel(bool value);
 
+		/*! \brief Starts a batch of objects addition. While a batch is active the signal s_objectAdded() is not
+		 *  emitted, instead, the added objects are notified at once via s_objectsAdded() when the batch ends.
+		 *  Batches can be nested, in that case, the signal is emitted only when the outermost batch ends */
+		void beginObjectsAddition();
+
+		//! \brief Ends the current objects addition batch (see beginObjectsAddition())
+		void endObjectsAddition();
+
 		/*! \brief This method forces the breaking of the code generation/saving in the methods getSourceCode, saveModel and saveSplitModel.
 		 *  This method is used only by the export helper in such a way to allow the user to abort any export to file in a threaded operation. */
 		void setCancelSaving(bool value);
@@ -302,6 +369,20 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		 * to the filename. Returns true when the file could be saved. */
 		bool saveSplitCustomSQL(bool save_appended, const QString &path, const QString &file_prefix);
 
+		/*! \brief Saves one of the files of a split SQL export registering its content hash. The file is not rewritten
+		 * when its contents on disk are the same of the buffer and its hash matches the one registered in the previous
+		 * incremental export. If the same contents were saved in another file by the previous export that file is renamed */
+		void saveSplitFile(const QString &path, const QString &filename, const QByteArray &buffer);
+
+		/*! \brief Registers the file written by the previous incremental export in the running one without generating its contents.
+		 * This is done only when the hash of the file in the previous export's manifest and the hash of the file on disk
+		 * are the same as the provided one. Returns false when the file can't be reused */
+		bool reuseSplitFile(const QString &path, const QString &filename, const QString &hash);
+
+		/*! \brief Returns true if the file exists and its contents has the provided MD5 hash. When a size is provided
+		 * the file is only read when it has that size */
+		static bool isSplitFileIntact(const QString &file, const QString &hash, qint64 size = -1);
+
 		//! \brief Returns true if there is at least one relationship in an invalid state
 		bool hasInvalidRelatioships();
 
@@ -312,6 +393,30 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Updates all the relationships in such a way to create the missing columns/constraints
 		void updateRelsGeneratedObjects();
 
+		/*! \brief Returns the relationships sorted in such a way that the ones propagating columns to a table
+		 * come before the ones copying columns from that table (parents before children). The creation order
+		 * is preserved whenever the dependencies allow it, including the relationships involved in cycles */
+		std::vector<Relationship *> getSortedRelationships();
+
+		/*! \brief Connects all the (previously disconnected) relationships, recreates the special objects and
+		 * removes the relationships that can't be connected anymore. The failed relationships are retried while
+		 * each retry connects at least one of them. When single_pass is true, the relationships are first connected
+		 * in the order returned by getSortedRelationships(), so retries are needed only for the ones involved in cycles.
+		 * This mode is used at the end of the model loading */
+		void reconnectRelationships(bool single_pass);
+
+		/*! \brief Returns the root's children elements of the loaded XML document that must be created when loading
+		 * the model using object filters (see findObjects()). The returned set contains the elements matching the filters,
+		 * the elements providing the objects named in extra_refs, the database element and, recursively, all the elements
+		 * they reference. Relationships, permissions, indexes, triggers, rules and policies are also returned when all the
+		 * objects they complete are selected (e.g. both tables of a relationship, or only the child table in inheritance,
+		 * partitioning and copy relationships, which pulls in the parent one). Note that relationships connecting a selected
+		 * table to a non selected one are skipped, so the columns and constraints they'd add to the tables are not created */
+		std::set<const xmlNode *> getFilteredElements(const QStringList &filters, const QString &search_attr, const QStringList &extra_refs);
+
+		//! \brief Discards the cached creation orders (see getCreationOrder())
+		void invalidateCreationOrders();
+
 	protected:
 		//! \brief Set the layer names (only to be written in the XML definition)
 		void setLayers(const QStringList &layers);
@@ -362,6 +467,9 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 			ChildrenSql
 		};
 
+		//! \brief The file that stores the hashes of the files generated by an incremental split SQL export
+		static const QString SplitManifestFile;
+
 		enum MetaAttrOptions: unsigned {
 			MetaNoOpts=0,
 			MetaDbAttributes=1,	//! \brief Handle database model attribute when save/load metadata file
@@ -432,8 +540,12 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 
 		/*! \brief Loads a database model from a file. In case of loading errors
 		the objects in the model will not be destroyed automatically. The user need to call
-		destroyObjects() or delete the entire model */
-		void loadModel(const QString &filename);
+		destroyObjects() or delete the entire model.
+
+		When a set of object filters (in the form type:pattern:mode) is provided only the objects
+		matching them and their dependencies are created, the rest of the file is skipped. The
+		search_attr has the same meaning as in findObjects() */
+		void loadModel(const QString &filename, const QStringList &filters = {}, const QString &search_attr = Attributes::Name);
 
 		//! \brief Sets the database encoding
 		void setEncoding(EncodingType encod);
@@ -514,8 +626,16 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 
 		/*! \brief Saves the model's SQL code definition by creating separated files for each object
 		 * The provided path must be a directory. If it does not exists then the method will create
-		 * it prior to the generation of the files. */
-		void saveSplitSQLDefinition(const QString &path, CodeGenMode code_gen_mode = OriginalSql);
+		 * it prior to the generation of the files.
+		 *
+		 * In incremental mode, the MD5 hashes of the generated files are stored in a manifest file (see SplitManifestFile)
+		 * in the output directory, which is used only to verify the files on disk in the next incremental exports.
+		 * When the same model is exported again, the code of the objects not invalidated since the previous export
+		 * (see BaseObject::isCodeExported()) isn't generated as long as their files are intact. For the other objects the code
+		 * is generated but the files in which contents didn't change are not rewritten and the files in which contents only
+		 * moved to another name are renamed. The files of the previous export that are not generated anymore (e.g. removed objects)
+		 * are deleted. In non incremental mode any existing manifest is removed since the files it describes are overwritten */
+		void saveSplitSQLDefinition(const QString &path, CodeGenMode code_gen_mode = OriginalSql, bool incremental = false);
 
 		/*! \brief Returns the complete SQL/XML defintion for the entire model (including all the other objects).
 		 The parameter 'export_file' is used to format the generated code in a way that can be saved
@@ -553,6 +673,10 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		the object. */
 		std::vector<BaseObject *> getCreationOrder(BaseObject *object, bool only_children);
 
+		/*! \brief Computes the creation order of the objects for the specified code type without using the cache.
+		 * See getCreationOrder(SchemaParser::CodeType, bool, bool) for details about the parameters */
+		std::map<unsigned, BaseObject *> __getCreationOrder(SchemaParser::CodeType def_type, bool incl_relnn_objs=false, bool incl_rel1n_constrs=false);
+
 		void addRelationship(BaseRelationship *rel, int obj_idx=-1);
 		void removeRelationship(BaseRelationship *rel, int obj_idx=-1);
 		BaseRelationship *getRelationship(unsigned obj_idx, ObjectType rel_type);
@@ -716,6 +840,17 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		permission and the ones existent in the model */
 		int getPermissionIndex(Permission *perm, bool exact_match);
 
+		/*! \brief Returns the permission in the model that matches the provided one or nullptr if there's no match.
+		 * The exact_match parameter has the same meaning as in getPermissionIndex(). Differently from that method,
+		 * this one uses the internal permission indexes and doesn't scan the whole permissions list */
+		Permission *findPermission(Permission *perm, bool exact_match);
+
+		/*! \brief Discards the similarity keys index used by findPermission(). The index is rebuilt in the next exact match search.
+		 * This is done automatically whenever the code of any of the model's objects is invalidated (e.g. when the objects referenced
+		 * by the permissions are renamed, see setCodeInvalidated()). Explicit calls are only needed for changes that
+		 * modify the permissions' similarity keys without invalidating code (e.g. a permission assigned in place) */
+		void invalidatePermissionsIndex();
+
 		//! \brief Inserts a list of permissions into the model
 		void addPermissions(const std::vector<Permission *> &perms);
 
@@ -829,6 +964,10 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		 graphical objects to be marked */
 		void setCodesInvalidated(std::vector<ObjectType> types={});
 
+		/*! \brief Marks the model's code as invalidated. Since the objects forward their invalidations to their model,
+		 * this method also discards the cached creation orders and the permissions index whenever any object of the model changes */
+		void setCodeInvalidated(bool value);
+
 		/*! \brief Updates the user type names which belongs to the passed schema. This method must be executed whenever
 		 the schema is renamed to propagate the new name to the user types on the PgSQLTypes list. Additionally
 		 the previous schema name must be informed in order to rename the types correctly */
@@ -920,6 +1059,9 @@ class __libcore DatabaseModel:  public QObject, public BaseObject {
 		//! \brief Signal emitted when a new object is added to the model
 		void s_objectAdded(BaseObject *object);
 
+		//! \brief Signal emitted when a batch of objects addition ends (see beginObjectsAddition())
+		void s_objectsAdded(std::vector<BaseObject *> objects);
+
 		//! \brief Signal emitted when an object is removed from the model
 		void s_objectRemoved(BaseObject *object);
 
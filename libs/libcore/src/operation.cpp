@@ -26,6 +26,10 @@ Operation::Operation()
 	object_idx=-1;
 	chain_type=NoChain;
 	op_type=NoOperation;
+	payload_type=FullCopy;
+	estimated_size=0;
+	journal_pos=-1;
+	journal_size=0;
 }
 
 QString Operation::generateOperationId()
@@ -87,6 +91,27 @@ void Operation::setXMLDefinition(const QString &xml_def)
 	xml_definition=xml_def;
 }
 
+void Operation::setPayloadType(PayloadType type)
+{
+	payload_type=(type > GraphicDelta ? FullCopy : type);
+}
+
+void Operation::setGraphicState(const GraphicState &state)
+{
+	graph_state=state;
+}
+
+void Operation::setEstimatedSize(size_t size)
+{
+	estimated_size=size;
+}
+
+void Operation::setJournalEntry(qint64 pos, qint64 size)
+{
+	journal_pos=pos;
+	journal_size=(pos < 0 ? 0 : size);
+}
+
 int Operation::getObjectIndex()
 {
 	return object_idx;
@@ -127,6 +152,36 @@ QString Operation::getXMLDefinition()
 	return xml_definition;
 }
 
+Operation::PayloadType Operation::getPayloadType()
+{
+	return payload_type;
+}
+
+Operation::GraphicState Operation::getGraphicState()
+{
+	return graph_state;
+}
+
+size_t Operation::getEstimatedSize()
+{
+	return estimated_size;
+}
+
+qint64 Operation::getJournalPosition()
+{
+	return journal_pos;
+}
+
+qint64 Operation::getJournalSize()
+{
+	return journal_size;
+}
+
+bool Operation::isPayloadInJournal()
+{
+	return journal_pos >= 0;
+}
+
 bool Operation::isOperationValid()
 {
 	return (operation_id==generateOperationId());
@@ -28,6 +28,7 @@
 #include "baseobject.h"
 #include "permission.h"
 #include <QString>
+#include <QPointF>
 
 class __libcore Operation {
 	public:
@@ -45,6 +46,30 @@ class __libcore Operation {
 			ObjMoved
 		};
 
+		/*! \brief Types of the payload stored by the operation in order to restore the object's previous state.
+		 * Delta payloads avoid copying the whole object when only its graphical attributes are changed */
+		enum PayloadType: unsigned {
+			//! \brief A full copy of the object is stored in the pool (or the object itself for creation/removal)
+			FullCopy,
+
+			//! \brief Only the position of the graphical object is stored
+			PositionDelta,
+
+			//! \brief Only the graphical attributes (position, z value, line points, labels distances) are stored
+			GraphicDelta
+		};
+
+		//! \brief Stores the graphical attributes of an object handled by the delta payloads
+		struct GraphicState {
+			QPointF position;
+
+			int z_value = 0;
+
+			std::vector<QPointF> points;
+
+			std::vector<QPointF> labels_dists;
+		};
+
 		//! \brief Operation chain types
 		enum ChainType: unsigned {
 			NoChain, //! \brief The operation is not part of a chain
@@ -88,6 +113,19 @@ class __libcore Operation {
 		//! \brief Stores the object's permission before it's removal
 		std::vector<Permission *> permissions;
 
+		//! \brief Type of the payload used to restore the object
+		PayloadType payload_type;
+
+		//! \brief Stores the graphical attributes of the object when a delta payload is used
+		GraphicState graph_state;
+
+		//! \brief Estimated amount of memory (in bytes) held by the operation
+		size_t estimated_size;
+
+		/*! \brief Position and size (in bytes) of the operation's payload in the operation list's journal.
+		 * A negative position means that the payload is held in memory */
+		qint64 journal_pos, journal_size;
+
 		//! \brief Generate an unique id for the operation based upon the memory addresses of objects held by it
 		QString generateOperationId();
 
@@ -102,6 +140,10 @@ class __libcore Operation {
 		void setParentObject(BaseObject *object);
 		void setPermissions(const std::vector<Permission *> &perms);
 		void setXMLDefinition(const QString &xml_def);
+		void setPayloadType(PayloadType type);
+		void setGraphicState(const GraphicState &state);
+		void setEstimatedSize(size_t size);
+		void setJournalEntry(qint64 pos, qint64 size);
 
 		int getObjectIndex();
 		ChainType getChainType();
@@ -111,6 +153,14 @@ class __libcore Operation {
 		BaseObject *getParentObject();
 		std::vector<Permission *> getPermissions();
 		QString getXMLDefinition();
+		PayloadType getPayloadType();
+		GraphicState getGraphicState();
+		size_t getEstimatedSize();
+		qint64 getJournalPosition();
+		qint64 getJournalSize();
+
+		//! \brief Returns if the operation's payload was moved to the operation list's journal
+		bool isPayloadInJournal();
 		bool isOperationValid();
 };
 
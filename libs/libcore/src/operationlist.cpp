@@ -18,8 +18,11 @@
 
 #include "operationlist.h"
 #include "coreutilsns.h"
+#include "globalattributes.h"
+#include <QDataStream>
 
 unsigned OperationList::max_size=500;
+unsigned OperationList::max_memory=512;
 
 OperationList::OperationList(DatabaseModel *model)
 {
@@ -34,6 +37,7 @@ OperationList::OperationList(DatabaseModel *model)
 	next_op_chain=Operation::NoChain;
 	ignore_chain=false;
 	operations.reserve(max_size);
+	journal.setFileTemplate(GlobalAttributes::getTemporaryFilePath("oplist_XXXXXX.journal"));
 }
 
 OperationList::~OperationList()
@@ -51,6 +55,21 @@ unsigned OperationList::getMaximumSize()
 	return max_size;
 }
 
+unsigned OperationList::getMaximumMemory()
+{
+	return max_memory;
+}
+
+size_t OperationList::getMemoryUsage()
+{
+	size_t mem_usage=0;
+
+	for(auto &oper : operations)
+		mem_usage+=oper->getEstimatedSize();
+
+	return mem_usage;
+}
+
 int OperationList::getCurrentIndex()
 {
 	return current_index;
@@ -110,16 +129,34 @@ bool OperationList::isOperationChainStarted()
 
 bool OperationList::isObjectRegistered(BaseObject *object, Operation::OperType op_type)
 {
-	bool registered=false;
-	std::vector<Operation *>::iterator itr=operations.begin();
+	auto range=registered_objs.equal_range(object);
 
-	while(itr!=operations.end() && !registered)
+	for(auto itr=range.first; itr!=range.second; itr++)
 	{
-		registered=((*itr)->getOriginalObject()==object && (*itr)->getOperationType()==op_type);
-		itr++;
+		if(itr->second==op_type)
+			return true;
 	}
 
-	return registered;
+	return false;
+}
+
+void OperationList::addToRegisteredIndex(Operation *oper)
+{
+	registered_objs.insert({ oper->getOriginalObject(), oper->getOperationType() });
+}
+
+void OperationList::removeFromRegisteredIndex(Operation *oper)
+{
+	auto range=registered_objs.equal_range(oper->getOriginalObject());
+
+	for(auto itr=range.first; itr!=range.second; itr++)
+	{
+		if(itr->second==oper->getOperationType())
+		{
+			registered_objs.erase(itr);
+			break;
+		}
+	}
 }
 
 bool OperationList::isRedoAvailable()
@@ -146,7 +183,12 @@ void OperationList::setMaximumSize(unsigned max)
 	max_size=max;
 }
 
-void OperationList::addToPool(BaseObject *object, Operation::OperType op_type)
+void OperationList::setMaximumMemory(unsigned max_mb)
+{
+	max_memory=max_mb;
+}
+
+void OperationList::addToPool(BaseObject *object, Operation::OperType op_type, Operation::PayloadType payload_type)
 {
 	ObjectType obj_type;
 
@@ -159,9 +201,11 @@ void OperationList::addToPool(BaseObject *object, Operation::OperType op_type)
 
 		obj_type=object->getObjectType();
 
-		//Stores a copy of the object if its about to be moved or modified
-		if(op_type==Operation::ObjModified ||
-				op_type==Operation::ObjMoved)
+		/* Stores a copy of the object if its about to be moved or modified. Delta payloads
+		 * don't need the copy since the changed attributes are stored in the operation itself */
+		if(payload_type==Operation::FullCopy &&
+			 (op_type==Operation::ObjModified ||
+				op_type==Operation::ObjMoved))
 		{
 			BaseObject *copy_obj=nullptr;
 
@@ -174,12 +218,18 @@ void OperationList::addToPool(BaseObject *object, Operation::OperType op_type)
 			if(!copy_obj)
 				throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 			else
+			{
 				//Inserts the copy on the pool
 				object_pool.push_back(copy_obj);
+				pool_objs.insert(copy_obj);
+			}
 		}
 		else
-			//Inserts the original object on the pool (in case of adition or deletion operations)
+		{
+			//Inserts the original object on the pool (in case of adition, deletion or delta operations)
 			object_pool.push_back(object);
+			pool_objs.insert(object);
+		}
 	}
 	catch(Exception &e)
 	{
@@ -187,6 +237,88 @@ void OperationList::addToPool(BaseObject *object, Operation::OperType op_type)
 	}
 }
 
+size_t OperationList::getEstimatedSize(BaseObject *object, Operation::OperType op_type, Operation::PayloadType payload_type)
+{
+	size_t size=sizeof(Operation);
+	BaseTable *tab=dynamic_cast<BaseTable *>(object);
+	Relationship *rel=dynamic_cast<Relationship *>(object);
+
+	if(payload_type!=Operation::FullCopy)
+	{
+		BaseRelationship *base_rel=dynamic_cast<BaseRelationship *>(object);
+
+		if(base_rel)
+			size+=(base_rel->getPoints().size() + 3) * sizeof(QPointF);
+
+		return size;
+	}
+
+	//Created objects are held by the model so only the operation itself is accounted
+	if(op_type==Operation::ObjCreated)
+		return size;
+
+	size+=ObjectEstimatedSize;
+
+	//The children objects of tables and relationships are copied (or held) together with them
+	if(tab)
+		size+=ObjectEstimatedSize * tab->getObjects().size();
+	else if(rel)
+		size+=ObjectEstimatedSize * (rel->getObjectCount(ObjectType::Column) + rel->getObjectCount(ObjectType::Constraint));
+
+	return size;
+}
+
+Operation::GraphicState OperationList::getGraphicState(BaseGraphicObject *object, Operation::PayloadType payload_type)
+{
+	Operation::GraphicState state;
+	BaseRelationship *rel=dynamic_cast<BaseRelationship *>(object);
+
+	if(!object)
+		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	state.position=object->getPosition();
+
+	if(payload_type==Operation::GraphicDelta)
+	{
+		state.z_value=object->getZValue();
+
+		if(rel)
+		{
+			state.points=rel->getPoints();
+
+			for(auto lbl_id : { BaseRelationship::SrcCardLabel, BaseRelationship::DstCardLabel, BaseRelationship::RelNameLabel })
+				state.labels_dists.push_back(rel->getLabelDistance(lbl_id));
+		}
+	}
+
+	return state;
+}
+
+void OperationList::restoreGraphicState(Operation *oper)
+{
+	BaseGraphicObject *graph_obj=dynamic_cast<BaseGraphicObject *>(oper->getPoolObject());
+	BaseRelationship *rel=dynamic_cast<BaseRelationship *>(graph_obj);
+	Operation::GraphicState state=oper->getGraphicState();
+	unsigned lbl_id=BaseRelationship::SrcCardLabel;
+
+	//Storing the current state so the operation can be executed in the opposite direction
+	oper->setGraphicState(getGraphicState(graph_obj, oper->getPayloadType()));
+	graph_obj->setPosition(state.position);
+
+	if(oper->getPayloadType()==Operation::GraphicDelta)
+	{
+		graph_obj->setZValue(state.z_value);
+
+		if(rel)
+		{
+			rel->setPoints(state.points);
+
+			for(auto &dist : state.labels_dists)
+				rel->setLabelDistance(static_cast<BaseRelationship::LabelId>(lbl_id++), dist);
+		}
+	}
+}
+
 void OperationList::removeOperations()
 {
 	BaseObject *object=nullptr;
@@ -210,6 +342,8 @@ void OperationList::removeOperations()
 		operations.pop_back();
 	}
 
+	registered_objs.clear();
+
 	//Destroy the object pool
 	while(!object_pool.empty())
 		removeFromPool(0);
@@ -264,51 +398,84 @@ void OperationList::removeOperations()
 
 	current_index=0;
 	unallocated_objs.clear();
+
+	//The payloads in the journal aren't referenced anymore so it's emptied
+	if(journal.isOpen())
+		journal.resize(0);
 }
 
-void OperationList::validateOperations()
+void OperationList::removeOldestOperations(size_t needed_size)
 {
-	std::vector<Operation *>::iterator itr, itr_end;
+	size_t mem_usage=getMemoryUsage(), max_mem=static_cast<size_t>(max_memory) * 1048576;
+	unsigned count=0;
+	bool chain_open=false;
 	Operation *oper=nullptr;
 
-	itr=operations.begin();
-	itr_end=operations.end();
-
-	while(itr!=itr_end)
+	/* Destroys the operations from the beginning of the list until the budget is respected.
+	 * Chained operations are always removed together so a chain is never left without its head */
+	while(count < operations.size() && (chain_open || mem_usage + needed_size > max_mem))
 	{
-		oper=(*itr);
+		oper=operations[count];
+
+		if(oper->getChainType()==Operation::ChainStart)
+			chain_open=true;
+		else if(oper->getChainType()==Operation::ChainEnd ||
+						oper->getChainType()==Operation::NoChain)
+			chain_open=false;
+
+		mem_usage-=std::min(mem_usage, oper->getEstimatedSize());
+		removePoolObject(oper);
+		removeFromRegisteredIndex(oper);
+		delete oper;
+		count++;
+	}
 
+	operations.erase(operations.begin(), operations.begin() + count);
+	current_index=std::max(0, current_index - static_cast<int>(count));
+
+	/* If the chain currently open was removed entirely the next operation
+	 * inserted on the list will be the new start of chain */
+	if(operations.empty() && next_op_chain==Operation::ChainMiddle)
+		next_op_chain=Operation::ChainStart;
+
+	//Validates the remaining operations after the deletion
+	validateOperations();
+}
+
+void OperationList::validateOperations()
+{
+	std::vector<Operation *>::iterator itr_valid=operations.begin();
+
+	/* Compacts the list in a single pass: the valid operations are moved to the
+	 * front of the list (keeping their order) and the invalid ones are destroyed */
+	for(auto &oper : operations)
+	{
 		//Case the object isn't on the pool
-		if(!isObjectOnPool((*itr)->getPoolObject()) ||
+		if(!isObjectOnPool(oper->getPoolObject()) ||
 				!oper->isOperationValid())
 		{
-			//Remove the operation
-			operations.erase(itr);
+			removeFromRegisteredIndex(oper);
 			delete oper;
-			itr=operations.begin();
-			itr_end=operations.end();
 		}
-		else itr++;
+		else
+		{
+			*itr_valid=oper;
+			itr_valid++;
+		}
 	}
+
+	operations.erase(itr_valid, operations.end());
+
+	//Reclaiming the journal space used by the removed operations
+	compactJournal();
 }
 
 bool OperationList::isObjectOnPool(BaseObject *object)
 {
-	bool found=false;
-	std::vector<BaseObject *>::iterator itr, itr_end;
-
 	if(!object)
 		throw Exception(ErrorCode::OprNotAllocatedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
-	itr=object_pool.begin();
-	itr_end=object_pool.end();
-	while(!found && itr!=itr_end)
-	{
-		found=*(itr)==object;
-		itr++;
-	}
-
-	return found;
+	return pool_objs.count(object) > 0;
 }
 
 void OperationList::removeFromPool(unsigned obj_idx)
@@ -326,6 +493,7 @@ void OperationList::removeFromPool(unsigned obj_idx)
 
 	//Removes the object from pool
 	object_pool.erase(itr);
+	pool_objs.erase(pool_objs.find(object));
 
 	/* Stores the object that was in the pool on the 'not_removed_objs' vector.
 		The object will be deleted in the destructor of the list. Note: The object is not
@@ -334,8 +502,23 @@ void OperationList::removeFromPool(unsigned obj_idx)
 	not_removed_objs.push_back(object);
 }
 
+void OperationList::removePoolObject(Operation *oper)
+{
+	std::vector<BaseObject *>::reverse_iterator itr;
 
-int OperationList::registerObject(BaseObject *object, Operation::OperType op_type, int object_idx, BaseObject *parent_obj)
+	if(!oper)
+		return;
+
+	/* Searching the pool object from the end of the pool since the most recent operations
+	 * are the ones usually removed. Objects of delta payloads may appear more than once in the pool
+	 * so only one occurrence is removed, keeping the other operations that use the object valid */
+	itr=std::find(object_pool.rbegin(), object_pool.rend(), oper->getPoolObject());
+
+	if(itr!=object_pool.rend())
+		removeFromPool(std::distance(itr, object_pool.rend()) - 1);
+}
+
+int OperationList::registerObject(BaseObject *object, Operation::OperType op_type, int object_idx, BaseObject *parent_obj, Operation::PayloadType payload_type)
 {
 	ObjectType obj_type;
 	Operation *operation=nullptr;
@@ -344,6 +527,7 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 	TableObject *tab_obj=nullptr;
 	tab_obj=dynamic_cast<TableObject *>(object);
 	int obj_idx=-1;
+	size_t op_size=0;
 
 	try
 	{
@@ -372,28 +556,50 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 		 as well as the objects in the pool that were linked to the excluded operations */
 		if(current_index>=0 && static_cast<unsigned>(current_index)!=operations.size())
 		{
-			//Gets the last operation index
-			int i=operations.size()-1;
-
-			//Removes all the operation while the current index isn't reached
-			while(i >= current_index)
+			/* Destroys the operations from the last one until the current index is reached. The operations are
+			 * removed explicitly because the objects of delta payloads can be in the pool more than once, so
+			 * removing only their pool objects isn't enough to invalidate the excluded operations */
+			for(int i=operations.size()-1; i >= current_index; i--)
 			{
-				removeFromPool(i);
-				i--;
+				removePoolObject(operations[i]);
+				removeFromRegisteredIndex(operations[i]);
+				delete operations[i];
 			}
 
+			operations.erase(operations.begin() + current_index, operations.end());
+
 			//Validates the remaining operatoins after the deletion
 			validateOperations();
 		}
 
+		/* Moved graphical objects have only their position stored (or their line points in case of relationships).
+		 * Deltas are only used for graphical objects, any other object has a full copy stored */
+		if(!BaseGraphicObject::isGraphicObject(obj_type) ||
+			 (op_type!=Operation::ObjModified && op_type!=Operation::ObjMoved))
+			payload_type=Operation::FullCopy;
+		else if(op_type==Operation::ObjMoved)
+			payload_type=(obj_type==ObjectType::Relationship || obj_type==ObjectType::BaseRelationship ?
+											Operation::GraphicDelta : Operation::PositionDelta);
+
+		/* If the memory budget of the list is exhausted the payloads of the oldest operations are moved to the journal.
+		 * The oldest operations are discarded only if that isn't enough to respect the budget */
+		op_size=getEstimatedSize(object, op_type, payload_type);
+
+		if(max_memory > 0 && !moveToJournal(op_size))
+			removeOldestOperations(op_size);
+
 		//Creates the new operation
 		operation=new Operation;
 		operation->setOperationType(op_type);
 		operation->setChainType(next_op_chain);
 		operation->setOriginalObject(object);
+		operation->setPayloadType(payload_type);
+
+		if(payload_type!=Operation::FullCopy)
+			operation->setGraphicState(getGraphicState(dynamic_cast<BaseGraphicObject *>(object), payload_type));
 
 		//Adds the object on te pool
-		addToPool(object, op_type);
+		addToPool(object, op_type, payload_type);
 
 		//Assigns the pool object to the operation
 		operation->setPoolObject(object_pool.back());
@@ -462,9 +668,10 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 		}
 		else
 		{
-			if((obj_type==ObjectType::Sequence && dynamic_cast<Sequence *>(object)->isReferRelationshipAddedColumn()) ||
+			if(payload_type==Operation::FullCopy &&
+				 ((obj_type==ObjectType::Sequence && dynamic_cast<Sequence *>(object)->isReferRelationshipAddedColumn()) ||
 					(obj_type==ObjectType::View && dynamic_cast<View *>(object)->isReferRelationshipAddedColumn()) ||
-					(obj_type==ObjectType::GenericSql && dynamic_cast<GenericSQL *>(object)->isReferRelationshipAddedObject()))
+					(obj_type==ObjectType::GenericSql && dynamic_cast<GenericSQL *>(object)->isReferRelationshipAddedObject())))
 				operation->setXMLDefinition(object->getSourceCode(SchemaParser::XmlCode));
 
 			//Case a specific index wasn't specified
@@ -480,7 +687,9 @@ int OperationList::registerObject(BaseObject *object, Operation::OperType op_typ
 			operation->setXMLDefinition(object->getSourceCode(SchemaParser::XmlCode));
 
 		operation->setObjectIndex(obj_idx);
+		operation->setEstimatedSize(op_size + (operation->getXMLDefinition().size() * sizeof(QChar)));
 		operations.push_back(operation);
+		addToRegisteredIndex(operation);
 		current_index=operations.size();
 
 		//Registering a log entry for the object modification in database model's change log
@@ -682,8 +891,128 @@ void OperationList::redoOperation()
 	}
 }
 
+bool OperationList::moveToJournal(size_t needed_size)
+{
+	size_t mem_usage=getMemoryUsage(), max_mem=static_cast<size_t>(max_memory) * 1048576;
+
+	//Reclaiming the space of entries that were reloaded or which operations were removed before appending new ones
+	compactJournal();
+
+	for(auto &oper : operations)
+	{
+		if(mem_usage + needed_size <= max_mem)
+			break;
+
+		if(!oper->isPayloadInJournal() && oper->isOperationValid())
+			mem_usage-=moveToJournal(oper);
+	}
+
+	return (mem_usage + needed_size <= max_mem);
+}
+
+size_t OperationList::moveToJournal(Operation *oper)
+{
+	QByteArray buffer;
+	size_t released=0;
+	qint64 pos=0;
+
+	/* Only the XML definitions are moved to the journal. The pool objects (copies, originals or deltas)
+	 * are kept in memory because rebuilding a copy from its XML code resolves its references (schema, owner,
+	 * types, etc) by name in the model at undo time, and those objects may have been renamed or removed since then */
+	if(oper->getXMLDefinition().isEmpty())
+		return 0;
+
+	if(!journal.isOpen() && !journal.open())
+		return 0;
+
+	QDataStream stream(&buffer, QIODevice::WriteOnly);
+	stream << oper->getXMLDefinition();
+	buffer=qCompress(buffer);
+
+	pos=journal.size();
+	journal.seek(pos);
+
+	if(journal.write(buffer)!=buffer.size())
+		return 0;
+
+	oper->setJournalEntry(pos, buffer.size());
+	released=oper->getXMLDefinition().size() * sizeof(QChar);
+	oper->setXMLDefinition("");
+
+	released=std::min(released, oper->getEstimatedSize());
+	oper->setEstimatedSize(oper->getEstimatedSize() - released);
+	return released;
+}
+
+void OperationList::loadFromJournal(Operation *oper)
+{
+	QByteArray buffer;
+	QString xml_def;
+
+	journal.seek(oper->getJournalPosition());
+	buffer=qUncompress(journal.read(oper->getJournalSize()));
+
+	if(buffer.isEmpty())
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotAccessed).arg(journal.fileName()),
+										ErrorCode::FileDirectoryNotAccessed,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	QDataStream stream(&buffer, QIODevice::ReadOnly);
+	stream >> xml_def;
+
+	oper->setXMLDefinition(xml_def);
+	oper->setJournalEntry(-1, 0);
+	oper->setEstimatedSize(oper->getEstimatedSize() + (xml_def.size() * sizeof(QChar)));
+}
+
+void OperationList::compactJournal()
+{
+	std::vector<Operation *> opers;
+	QByteArray buffer;
+	qint64 live_size=0, pos=0;
+
+	if(!journal.isOpen())
+		return;
+
+	for(auto &oper : operations)
+	{
+		if(oper->isPayloadInJournal())
+		{
+			opers.push_back(oper);
+			live_size+=oper->getJournalSize();
+		}
+	}
+
+	//The journal is compacted only when the unreferenced entries take more than a half of the file
+	if(journal.size() - live_size <= live_size)
+		return;
+
+	/* The entries are moved towards the beginning of the file in the order they were written,
+	 * so an entry is never overwritten before being moved */
+	std::sort(opers.begin(), opers.end(), [](Operation *oper1, Operation *oper2){
+		return oper1->getJournalPosition() < oper2->getJournalPosition();
+	});
+
+	for(auto &oper : opers)
+	{
+		journal.seek(oper->getJournalPosition());
+		buffer=journal.read(oper->getJournalSize());
+
+		journal.seek(pos);
+		journal.write(buffer);
+
+		oper->setJournalEntry(pos, buffer.size());
+		pos+=buffer.size();
+	}
+
+	journal.resize(pos);
+}
+
 void OperationList::executeOperation(Operation *oper, bool redo)
 {
+	//Operations which payloads were moved to the journal need them back before being executed
+	if(oper && oper->isOperationValid() && oper->isPayloadInJournal())
+		loadFromJournal(oper);
+
 	if(oper && oper->isOperationValid())
 	{
 		BaseObject *orig_obj=nullptr, *bkp_obj=nullptr,
@@ -743,9 +1072,13 @@ void OperationList::executeOperation(Operation *oper, bool redo)
 				aux_obj=model->createGenericSQL();
 		}
 
+		//Delta operations only have the stored graphical attributes of the object restored
+		if(oper->getPayloadType()!=Operation::FullCopy)
+			restoreGraphicState(oper);
+
 		/* If the operation is a modified/moved object, the object copy
 			stored in the pool will be restored */
-		if(op_type==Operation::ObjModified || op_type==Operation::ObjMoved)
+		else if(op_type==Operation::ObjModified || op_type==Operation::ObjMoved)
 		{
 			if(obj_type==ObjectType::Relationship)
 			{
@@ -901,8 +1234,11 @@ void OperationList::executeOperation(Operation *oper, bool redo)
 					op_type==Operation::ObjMoved)
 				graph_obj->setModified(true);
 
-			//Case the object is a view is necessary to update the table-view relationships on the model
-			if(obj_type==ObjectType::View && op_type==Operation::ObjModified)
+			/* Case the object is a view is necessary to update the table-view relationships on the model.
+			 * Delta operations restore only graphical attributes so there's nothing to be revalidated */
+			if(oper->getPayloadType()!=Operation::FullCopy)
+				graph_obj->setCodeInvalidated(true);
+			else if(obj_type==ObjectType::View && op_type==Operation::ObjModified)
 				model->updateViewRelationships(dynamic_cast<View *>(graph_obj));
 			else if((obj_type==ObjectType::Relationship ||
 							(PhysicalTable::isPhysicalTable(obj_type) && model->getRelationship(dynamic_cast<BaseTable *>(object), nullptr))) &&
@@ -941,7 +1277,7 @@ void OperationList::executeOperation(Operation *oper, bool redo)
 		}
 
 		//Case the object is a type update the tables that are referencing it
-		if(op_type==Operation::ObjModified &&
+		if(op_type==Operation::ObjModified && oper->getPayloadType()==Operation::FullCopy &&
 				(object->getObjectType()==ObjectType::Type || object->getObjectType()==ObjectType::Domain ||
 				 object->getObjectType()==ObjectType::Table || object->getObjectType()==ObjectType::ForeignTable ||
 				 object->getObjectType()==ObjectType::View || object->getObjectType()==ObjectType::Extension))
@@ -975,7 +1311,7 @@ void OperationList::removeLastOperation()
 			oper=(*itr);
 
 			//Removes the object related to the operation from the pool
-			removeFromPool(oper_idx);
+			removePoolObject(oper);
 
 			/* Stop condition for removing the operation:
 			 1) The operation is not chained with others, or
@@ -999,7 +1335,9 @@ void OperationList::removeLastOperation()
 
 		//Erasing the excluded operations
 		for(int i=operations.size()-1; i > oper_idx ; i--)
-			operations.erase(operations.begin() + i);
+			removeFromRegisteredIndex(operations[i]);
+
+		operations.erase(operations.begin() + (oper_idx + 1), operations.end());
 
 		//Validates the remaining operations
 		validateOperations();
@@ -30,6 +30,9 @@ undo / redo all the operations made.
 
 #include "databasemodel.h"
 #include "operation.h"
+#include <QTemporaryFile>
+#include <unordered_set>
+#include <unordered_map>
 
 class __libcore OperationList: public QObject {
 	private:
@@ -43,6 +46,13 @@ class __libcore OperationList: public QObject {
 		//! \brief List of objects that were removed / modified on the model
 		std::vector<BaseObject *> object_pool;
 
+		/*! \brief Hash index of the objects in the pool used to speed up the pool lookups.
+		 * A multiset is used because delta payloads may store the same original object more than once */
+		std::unordered_multiset<BaseObject *> pool_objs;
+
+		//! \brief Hash index of the objects (and their operation types) registered in the list
+		std::unordered_multimap<BaseObject *, Operation::OperType> registered_objs;
+
 		/*! \brief List of objects that at the time of deletion from pool were still referenced
 		 somehow on the model. The object is stored in this secondary list and
 		 deleted when the whole list of operations is destroyed */
@@ -58,8 +68,19 @@ class __libcore OperationList: public QObject {
 		//! \brief Database model that is linked with this operation list
 		DatabaseModel *model;
 
+		/*! \brief Compressed on-disk journal (in the temporary directory) that receives the XML definitions of the
+		 * oldest operations when the memory limit of the list is reached. The definitions are reloaded on demand.
+		 * Pool objects aren't journaled since they hold direct references to other objects in the model */
+		QTemporaryFile journal;
+
 		//! \brief Maximum number of stored operations (global)
-		static unsigned max_size;
+		static unsigned max_size,
+
+		//! \brief Maximum amount of memory (in MB) that the stored operations can hold (global). Zero means no limit
+		max_memory;
+
+		//! \brief Estimated amount of memory (in bytes) used by the copy of a single object in the pool
+		static constexpr size_t ObjectEstimatedSize = 2048;
 
 		/*! \brief Stores the type of chain to the next operation to be stored
 		 in the list. This attribute is used in conjunction with the chaining
@@ -75,16 +96,54 @@ class __libcore OperationList: public QObject {
 		 referenced in the model. */
 		void validateOperations();
 
+		//! \brief Adds/removes the provided operation to/from the index of registered objects
+		void addToRegisteredIndex(Operation *oper);
+		void removeFromRegisteredIndex(Operation *oper);
+
 		//! \brief Checks whether the passed object is in the pool
 		bool isObjectOnPool(BaseObject *object);
 
-		//! \brief Adds the object on the pool according to the operation type passed
-		void addToPool(BaseObject *object, Operation::OperType op_type);
+		/*! \brief Adds the object on the pool according to the operation and payload types passed.
+		 * For delta payloads the original object is stored in the pool instead of a copy */
+		void addToPool(BaseObject *object, Operation::OperType op_type, Operation::PayloadType payload_type);
+
+		//! \brief Returns the estimated amount of memory (in bytes) needed to register the operation over the object
+		size_t getEstimatedSize(BaseObject *object, Operation::OperType op_type, Operation::PayloadType payload_type);
+
+		//! \brief Returns the graphical attributes of the object that are handled by the provided delta payload type
+		Operation::GraphicState getGraphicState(BaseGraphicObject *object, Operation::PayloadType payload_type);
+
+		/*! \brief Restores the graphical attributes of the object stored in a delta payload operation.
+		 * The current attributes of the object are stored in the operation so it can be executed in the opposite direction */
+		void restoreGraphicState(Operation *oper);
+
+		/*! \brief Moves the payloads of the oldest operations to the journal until the estimated memory usage of the
+		 * list plus the provided amount of bytes fits the memory limit. Returns false if the limit can't be respected */
+		bool moveToJournal(size_t needed_size);
+
+		/*! \brief Removes the oldest operations (whole chains at once) until the estimated memory usage of the
+		 * list plus the provided amount of bytes fits the memory limit. Used when the journal can't release enough memory */
+		void removeOldestOperations(size_t needed_size);
+
+		/*! \brief Moves the XML definition stored in the operation to the journal.
+		 * Returns the estimated amount of memory released */
+		size_t moveToJournal(Operation *oper);
+
+		//! \brief Reloads the payload of the operation previously moved to the journal
+		void loadFromJournal(Operation *oper);
+
+		/*! \brief Rewrites the journal keeping only the entries of the existing operations. This is done only when
+		 * the entries of removed operations or reloaded payloads take more than a half of the file */
+		void compactJournal();
 
 		/*! \brief Removes one object from the pool using its index and deallocating
 		 it in case the object is not referenced on the model */
 		void removeFromPool(unsigned obj_idx);
 
+		/*! \brief Removes the pool object of the provided operation. This method is preferred over removing
+		 * the object by index since the pool and the operations list aren't always paired by position */
+		void removePoolObject(Operation *oper);
+
 		/*! \brief Executes the passed operation. The default behavior is the 'undo' if
 		 the user passes the parameter 'redo=true' the method executes the
 		 redo function */
@@ -138,6 +197,9 @@ class __libcore OperationList: public QObject {
 		//! \brief Sets the maximum size for the list
 		static void setMaximumSize(unsigned max);
 
+		//! \brief Sets the maximum amount of memory (in MB) held by the operations in the list. Zero disables the limit
+		static void setMaximumMemory(unsigned max_mb);
+
 		/*! \brief Registers in the list of operations that the passed object suffered some kind
 		 of modification (modified, removed, inserted, moved) in addition the method stores
 		 its original content.
@@ -146,12 +208,24 @@ class __libcore OperationList: public QObject {
 		 object the order of restoration / re-execution of operations can be broken and cause
 	 segmentations fault.
 
+	 The payload type indicates how the object's state is stored. Moved graphical objects always
+	 have only their position (or line points, for relationships) stored. Modified graphical objects can
+	 have only their graphical attributes stored by using Operation::GraphicDelta, which must be used only
+	 when the modification doesn't change anything else in the object. In any other case a full copy is stored.
+
 	 In case of success this method returns an integer indicating the last registered operation ID */
-		int registerObject(BaseObject *object, Operation::OperType op_type, int object_idx=-1, BaseObject *parent_obj=nullptr);
+		int registerObject(BaseObject *object, Operation::OperType op_type, int object_idx=-1, BaseObject *parent_obj=nullptr,
+											 Operation::PayloadType payload_type=Operation::FullCopy);
 
 		//! \brief Gets the maximum size for the operation list
 		unsigned getMaximumSize();
 
+		//! \brief Gets the maximum amount of memory (in MB) held by the operation list
+		static unsigned getMaximumMemory();
+
+		//! \brief Gets the estimated amount of memory (in bytes) currently held by the operation list
+		size_t getMemoryUsage();
+
 		//! \brief Gets the current size for the operation list
 		unsigned getCurrentSize();
 
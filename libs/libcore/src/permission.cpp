@@ -184,27 +184,24 @@ bool Permission::isSimilarTo(Permission *perm)
 	if(!perm)
 		return false;
 
-	QStringList rol_names, fmt_rol_names;
-	std::vector<std::vector<Role *>*> vect_roles={ &this->roles, &perm->roles };
-	BaseObject *object=this->getObject(), *aux_object=perm->getObject();
+	return this == perm || this->getSimilarityKey() == perm->getSimilarityKey();
+}
 
-	//Generating a list with role names of both permissions
-	for(auto &roles : vect_roles)
-	{
-		for(auto &role : *roles)
-			rol_names.append(role->getName());
+QString Permission::getSimilarityKey()
+{
+	QStringList rol_names;
 
-		rol_names.sort();
-		fmt_rol_names.append(rol_names.join(','));
-		rol_names.clear();
-	}
+	for(auto &role : roles)
+		rol_names.append(role->getName());
 
-	return (((object==aux_object) ||
-					 (object && aux_object && object->getSignature()==aux_object->getSignature())) &&
-					this->getPermissionString()==perm->getPermissionString() &&
-					this->revoke==perm->revoke &&
-					fmt_rol_names[0]==fmt_rol_names[1]);
+	rol_names.sort();
 
+	/* The key fields are separated by line breaks since they can't be part of the objects' signatures,
+	 * the permission string or the role names, so two different permissions never share the same key */
+	return QStringList({ object ? object->getSignature() : "",
+											 getPermissionString(),
+											 revoke ? Attributes::True : "",
+											 rol_names.join(',') }).join('\n');
 }
 
 void Permission::removeRole(unsigned role_idx)
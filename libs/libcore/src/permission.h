@@ -152,9 +152,13 @@ class __libcore Permission: public BaseObject {
 		bool isRevoke();
 		bool isCascade();
 
-		//! \brief Returns the the specified permission is semantically the same as this permission
+		//! \brief Returns the the specified permission is semantically the same as this permission (i.e. both have the same similarity key)
 		bool isSimilarTo(Permission *perm);
 
+		/*! \brief Returns a key composed by the object's signature, privileges, revoke state and role names.
+		 * This key is used by isSimilarTo() to compare permissions, so it can also be used to index similar permissions */
+		QString getSimilarityKey();
+
 		//! \brief Returns if the passed object type accepts permission
 		static bool acceptsPermission(ObjectType obj_type, int privilege=-1);
 
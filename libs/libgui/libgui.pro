@@ -89,6 +89,7 @@ src/tools/modelvalidationwidget.cpp \
 src/utils/deletableitemdelegate.cpp \
 src/utils/htmlitemdelegate.cpp \
 src/utils/plaintextitemdelegate.cpp \
+src/utils/pngstreamwriter.cpp \
 src/utils/resultsetmodel.cpp \
 src/utils/syntaxhighlighter.cpp \
 src/utils/textblockinfo.cpp \
@@ -207,6 +208,7 @@ src/tools/modelvalidationwidget.h \
 src/utils/deletableitemdelegate.h \
 src/utils/htmlitemdelegate.h \
 src/utils/plaintextitemdelegate.h \
+src/utils/pngstreamwriter.h \
 src/utils/resultsetmodel.h \
 src/utils/syntaxhighlighter.h \
 src/utils/textblockinfo.h \
@@ -342,7 +344,8 @@ unix|windows: LIBS += $$LIBCANVAS_LIB \
 		      $$LIBCONNECTOR_LIB \
 		      $$LIBCORE_LIB \
 		      $$LIBPARSERS_LIB \
-		      $$LIBUTILS_LIB
+		      $$LIBUTILS_LIB \
+		      $$ZLIB_LIB
 
 INCLUDEPATH += $$LIBCANVAS_INC \
 	       $$LIBCONNECTOR_INC \
@@ -298,8 +298,7 @@ void PermissionWidget::addPermission()
 
 void PermissionWidget::updatePermission()
 {
-	Permission *perm=nullptr,*perm_bkp=nullptr;
-	int perm_idx=-1;
+	Permission *perm=nullptr,*perm_bkp=nullptr,*perm_aux=nullptr;
 
 	try
 	{
@@ -313,11 +312,14 @@ void PermissionWidget::updatePermission()
 		configurePermission(perm);
 
 		//Checking if the permission already exists on model
-		perm_idx=model->getPermissionIndex(perm, false);
+		perm_aux=model->findPermission(perm, false);
 
-		if(perm_idx < 0 || (perm_idx >=0 && model->getObject(perm_idx,ObjectType::Permission)==permission))
+		if(!perm_aux || perm_aux==permission)
 		{
 			(*permission)=(*perm);
+
+			//The permission was changed in place so its similarity key in the model's index is outdated
+			model->invalidatePermissionsIndex();
 			listPermissions();
 			cancelOperation();
 		}
@@ -330,6 +330,18 @@ CREATE TABLE public.table_b (\n \
 	connect(attribs_per_page_spb, &QSpinBox::valueChanged, this, [this](){
 		setConfigurationChanged(true);
 	});
+
+	connect(lod_title_zoom_spb, &QSpinBox::valueChanged, this, [this](){
+		setConfigurationChanged(true);
+	});
+
+	connect(lod_box_zoom_spb, &QSpinBox::valueChanged, this, [this](){
+		setConfigurationChanged(true);
+	});
+
+	connect(cache_obj_views_chk, &QCheckBox::toggled, this, [this](){
+		setConfigurationChanged(true);
+	});
 }
 
 AppearanceConfigWidget::~AppearanceConfigWidget()
@@ -504,6 +516,16 @@ void AppearanceConfigWidget::applyDesignCodeStyle()
 	attribs_per_page_spb->setValue(config_params[Attributes::Design][Attributes::AttribsPerPage].toUInt());
 	ext_attribs_per_page_spb->setValue(config_params[Attributes::Design][Attributes::ExtAttribsPerPage].toUInt());
 
+	// Older configuration files don't have the level of detail settings so we use the default ones
+	lod_title_zoom_spb->setValue(config_params[Attributes::Design].count(Attributes::LodTitleZoom) ?
+																 config_params[Attributes::Design][Attributes::LodTitleZoom].toUInt() :
+																 BaseObjectView::DefTitleOnlyZoom * 100);
+	lod_box_zoom_spb->setValue(config_params[Attributes::Design].count(Attributes::LodBoxZoom) ?
+															 config_params[Attributes::Design][Attributes::LodBoxZoom].toUInt() :
+															 BaseObjectView::DefBoxOnlyZoom * 100);
+
+	cache_obj_views_chk->setChecked(config_params[Attributes::Design][Attributes::CacheObjectViews] == Attributes::True);
+
 	/* If we can't identify at least one of the colors that compose the grid then we use default colors
 	 * avoiding black canvas or black grid color */
 	if(config_params[Attributes::Design].count(Attributes::GridColor) == 0 ||
@@ -622,6 +644,9 @@ void AppearanceConfigWidget::saveConfiguration()
 		attribs[Attributes::MinObjectOpacity]=QString::number(min_obj_opacity_spb->value());
 		attribs[Attributes::AttribsPerPage]=QString::number(attribs_per_page_spb->value());
 		attribs[Attributes::ExtAttribsPerPage]=QString::number(ext_attribs_per_page_spb->value());
+		attribs[Attributes::LodTitleZoom]=QString::number(lod_title_zoom_spb->value());
+		attribs[Attributes::LodBoxZoom]=QString::number(lod_box_zoom_spb->value());
+		attribs[Attributes::CacheObjectViews]=(cache_obj_views_chk->isChecked() ? Attributes::True : "");
 		attribs[Attributes::GridColor] = grid_color_cp->getColor(0).name();
 		attribs[Attributes::CanvasColor] = canvas_color_cp->getColor(0).name();
 		attribs[Attributes::DelimitersColor] = delimiters_color_cp->getColor(0).name();
@@ -818,6 +843,9 @@ void AppearanceConfigWidget::applyConfiguration()
 	BaseTableView::setAttributesPerPage(BaseTable::AttribsSection, attribs_per_page_spb->value());
 	BaseTableView::setAttributesPerPage(BaseTable::ExtAttribsSection, ext_attribs_per_page_spb->value());
 	ModelWidget::setMinimumObjectOpacity(min_obj_opacity_spb->value());
+	BaseObjectView::setLevelOfDetailZoom(BaseObjectView::TitleOnly, lod_title_zoom_spb->value() / 100.0);
+	BaseObjectView::setLevelOfDetailZoom(BaseObjectView::BoxOnly, lod_box_zoom_spb->value() / 100.0);
+	BaseObjectView::setItemCacheEnabled(cache_obj_views_chk->isChecked());
 
 	loadExampleModel();
 	model->setObjectsModified();
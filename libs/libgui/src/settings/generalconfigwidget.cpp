@@ -79,6 +79,7 @@ GeneralConfigWidget::GeneralConfigWidget(QWidget * parent) : BaseConfigWidget(pa
 
 	config_params[Attributes::Configuration][Attributes::GridSize]="";
 	config_params[Attributes::Configuration][Attributes::OpListSize]="";
+	config_params[Attributes::Configuration][Attributes::OpListMemory]="";
 	config_params[Attributes::Configuration][Attributes::AutoSaveInterval]="";
 	config_params[Attributes::Configuration][Attributes::PaperType]="";
 	config_params[Attributes::Configuration][Attributes::PaperOrientation]="";
@@ -193,6 +194,13 @@ void GeneralConfigWidget::loadConfiguration()
 		BaseConfigWidget::loadConfiguration(GlobalAttributes::GeneralConf, config_params, { Attributes::Id });
 
 		oplist_size_spb->setValue((config_params[Attributes::Configuration][Attributes::OpListSize]).toUInt());
+
+		//Older configuration files don't have the memory limit so the default one is used
+		if(config_params[Attributes::Configuration][Attributes::OpListMemory].isEmpty())
+			oplist_mem_spb->setValue(OperationList::getMaximumMemory());
+		else
+			oplist_mem_spb->setValue((config_params[Attributes::Configuration][Attributes::OpListMemory]).toUInt());
+
 		history_max_length_spb->setValue(config_params[Attributes::Configuration][Attributes::HistoryMaxLength].toUInt());
 
 		interv=(config_params[Attributes::Configuration][Attributes::AutoSaveInterval]).toUInt();
@@ -405,6 +413,7 @@ void GeneralConfigWidget::saveConfiguration()
 		config_params[Attributes::Configuration][Attributes::FirstRun]=Attributes::False;
 
 		config_params[Attributes::Configuration][Attributes::OpListSize]=QString::number(oplist_size_spb->value());
+		config_params[Attributes::Configuration][Attributes::OpListMemory]=QString::number(oplist_mem_spb->value());
 		config_params[Attributes::Configuration][Attributes::AutoSaveInterval]=QString::number(autosave_interv_chk->isChecked() ? autosave_interv_spb->value() : 0);
 		config_params[Attributes::Configuration][Attributes::PaperType]=QString::number(paper_cmb->currentIndex());
 		config_params[Attributes::Configuration][Attributes::PaperOrientation]=(portrait_rb->isChecked() ? Attributes::Portrait : Attributes::Landscape);
@@ -567,6 +576,7 @@ void GeneralConfigWidget::applyConfiguration()
 	ObjectsScene::setLockDelimiterScale(config_params[Attributes::Configuration][Attributes::LockPageDelimResize]==Attributes::True, 1);
 
 	OperationList::setMaximumSize(oplist_size_spb->value());
+	OperationList::setMaximumMemory(oplist_mem_spb->value());
 	BaseTableView::setHideExtAttributes(hide_ext_attribs_chk->isChecked());
 	BaseTableView::setHideTags(hide_table_tags_chk->isChecked());
 
@@ -605,6 +605,9 @@ void DatabaseImportHelper::importDatabase()
 		dbmodel->setLoadingModel(true);
 		dbmodel->setObjectListsCapacity(creation_order.size());
 
+		//The imported objects are notified to the views at once when the objects creation ends
+		dbmodel->beginObjectsAddition();
+
 		cached_names.clear();
 		cached_signatures.clear();
 
@@ -627,6 +630,8 @@ void DatabaseImportHelper::importDatabase()
 			dbmodel->validateRelationships();
 		}
 
+		dbmodel->endObjectsAddition();
+
 		if(!import_canceled)
 		{
 			swapSequencesTablesIds();
@@ -692,6 +697,9 @@ void DatabaseImportHelper::importDatabase()
 	}
 	catch(Exception &e)
 	{
+		if(dbmodel)
+			dbmodel->endObjectsAddition();
+
 		resetImportParameters();
 
 		/* When running in a separated thread (other than the main application thread)
@@ -114,6 +114,7 @@ ModelExportForm::ModelExportForm(QWidget *parent, Qt::WindowFlags f) : QDialog(p
 	connect(sql_standalone_rb, &QRadioButton::toggled, this, &ModelExportForm::selectSQLExportMode);
 	connect(sql_split_rb, &QRadioButton::toggled, this, &ModelExportForm::selectSQLExportMode);
 	connect(sql_split_rb, &QRadioButton::toggled, code_options_cmb, &QComboBox::setEnabled);
+	connect(sql_split_rb, &QRadioButton::toggled, incremental_chk, &QCheckBox::setEnabled);
 
 	pgsqlvers_cmb->addItems(PgSqlVersions::AllVersions);
 	pgsqlvers1_cmb->addItems(PgSqlVersions::AllVersions);
@@ -203,6 +204,8 @@ void ModelExportForm::exportModel()
 		//Export to png
 		if(export_to_img_rb->isChecked())
 		{
+			//All the objects need to be in the scene before rendering it in the export thread
+			model->createDeferredViews();
 			viewp=new QGraphicsView(model->scene);
 
 			if(png_rb->isChecked())
@@ -231,7 +234,8 @@ void ModelExportForm::exportModel()
 				progress_lbl->setText(tr("Saving file '%1'").arg(sql_file_sel->getSelectedFile()));
 				export_hlp.setExportToSQLParams(model->db_model, sql_file_sel->getSelectedFile(),
 																				pgsqlvers_cmb->currentText(), sql_split_rb->isChecked(),
-																				static_cast<DatabaseModel::CodeGenMode>(code_options_cmb->currentIndex()));
+																				static_cast<DatabaseModel::CodeGenMode>(code_options_cmb->currentIndex()),
+																				sql_split_rb->isChecked() && incremental_chk->isChecked());
 				export_thread->start();
 			}
 			else if(export_to_dict_rb->isChecked())
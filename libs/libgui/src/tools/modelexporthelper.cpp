@@ -1,5 +1,6 @@
 #include "modelexporthelper.h"
 #include <QSvgGenerator>
+#include "pngstreamwriter.h"
 #include "guiutilsns.h"
 
 ModelExportHelper::ModelExportHelper(QObject *parent) : QObject(parent)
@@ -17,7 +18,7 @@ void ModelExportHelper::resetExportParams()
 	connection=nullptr;
 	scene=nullptr;
 	zoom=100;
-	show_grid=show_delim=page_by_page=split=browsable=false;
+	show_grid=show_delim=page_by_page=split=incremental=browsable=false;
 	viewp=nullptr;
 	code_gen_mode=DatabaseModel::OriginalSql;
 }
@@ -61,7 +62,7 @@ void ModelExportHelper::setIgnoredErrors(const QStringList &err_codes)
 	ignored_errors.removeDuplicates();
 }
 
-void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode)
+void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode, bool incremental)
 {
 	if(!db_model)
 		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
@@ -84,7 +85,7 @@ void ModelExportHelper::exportToSQL(DatabaseModel *db_model, const QString &file
 		}
 		else
 		{
-			db_model->saveSplitSQLDefinition(filename, code_gen_mode);
+			db_model->saveSplitSQLDefinition(filename, code_gen_mode, incremental);
 			emit s_progressUpdated(100, tr("SQL files successfully written in `%1'.").arg(filename), ObjectType::BaseObject);
 		}
 
@@ -111,6 +112,7 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 	{
 		QPixmap pix;
 		bool prev_show_grd, prev_show_dlm;
+		BaseObjectView::LevelOfDetail prev_lod;
 		QGraphicsView *view = nullptr;
 		QList<QRectF> pages;
 		unsigned v_cnt=0, h_cnt=0, page_idx=1;
@@ -132,12 +134,16 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 		prev_show_grd = ObjectsScene::isShowGrid();
 		prev_show_dlm = ObjectsScene::isShowPageDelimiters();
 		bg_color = ObjectsScene::getCanvasColor();
+		prev_lod = scene->getLevelOfDetail();
 
 		//Sets the options passed by the user
 		ObjectsScene::setCanvasColor(QColor(255,255,255));
 		ObjectsScene::setShowGrid(show_grid);
 		ObjectsScene::setShowPageDelimiters(show_delim);
 		scene->setShowSceneLimits(false);
+		scene->setLevelOfDetail(BaseObjectView::FullDetail);
+		scene->setObjectsCacheEnabled(false);
+		scene->updatePendingRelationships();
 
 		if(page_by_page)
 		{
@@ -181,6 +187,35 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 			if(export_canceled) break;
 
 			rect = view->mapFromScene(pg_rect).boundingRect();
+
+			/* When exporting the whole model in a single image we render it in tiles
+			 * so the memory used doesn't grow with the size of the resulting image */
+			if(!page_by_page)
+			{
+				try
+				{
+					exportToTiledPNG(view, rect, file);
+				}
+				catch(Exception &e)
+				{
+					//Restoring the scene settings before throw error
+					ObjectsScene::setCanvasColor(bg_color);
+					ObjectsScene::setShowGrid(prev_show_grd);
+					ObjectsScene::setShowPageDelimiters(prev_show_dlm);
+					scene->setShowSceneLimits(true);
+					scene->setLevelOfDetail(prev_lod);
+					scene->setObjectsCacheEnabled(true);
+					scene->update();
+
+					if(view != viewp)
+						delete view;
+
+					throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+				}
+
+				continue;
+			}
+
 			pix = QPixmap(rect.size());
 			pix.fill();
 
@@ -196,8 +231,7 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 			view->render(&painter, QRect(), rect);
 			painter.end();
 
-			if(page_by_page)
-				file = tmpl_filename.arg(page_idx++);
+			file = tmpl_filename.arg(page_idx++);
 
 			//If the pixmap is not saved raises an error
 			if(!pix.save(file))
@@ -206,6 +240,8 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 				ObjectsScene::setCanvasColor(bg_color);
 				ObjectsScene::setShowGrid(prev_show_grd);
 				ObjectsScene::setShowPageDelimiters(prev_show_dlm);
+				scene->setLevelOfDetail(prev_lod);
+				scene->setObjectsCacheEnabled(true);
 				scene->update();
 
 				throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(file),
@@ -218,6 +254,8 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 		ObjectsScene::setShowGrid(prev_show_grd);
 		ObjectsScene::setShowPageDelimiters(prev_show_dlm);
 		scene->setShowSceneLimits(true);
+		scene->setLevelOfDetail(prev_lod);
+		scene->setObjectsCacheEnabled(true);
 		scene->update();
 
 		if(!export_canceled)
@@ -237,12 +275,74 @@ void ModelExportHelper::exportToPNG(ObjectsScene *scene, const QString &filename
 	}
 }
 
+void ModelExportHelper::exportToTiledPNG(QGraphicsView *view, const QRect &rect, const QString &filename)
+{
+	if(!view)
+		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	PngStreamWriter png_writer;
+	QPainter painter;
+	QImage tile;
+	int tile_h = 0, rows = 0, tile_idx = 1, tile_cnt = 0;
+
+	/* The tiles have the same width of the image so they can be streamed row by row to the PNG file,
+	 * their height is calculated so each tile doesn't exceed the maximum amount of memory */
+	tile_h = qBound<qint64>(1, TileMaxBytes / (static_cast<qint64>(rect.width()) * 4), rect.height());
+	tile_cnt = ceil(rect.height() / static_cast<double>(tile_h));
+	tile = QImage(rect.width(), tile_h, QImage::Format_RGB32);
+
+	if(tile.isNull())
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	try
+	{
+		png_writer.open(filename, rect.size());
+
+		for(int y = 0; y < rect.height() && !export_canceled; y += tile_h, tile_idx++)
+		{
+			rows = std::min(tile_h, rect.height() - y);
+
+			emit s_progressUpdated((tile_idx/static_cast<double>(tile_cnt)) * 90,
+														 tr("Rendering objects to image tile %1/%2.").arg(tile_idx).arg(tile_cnt), ObjectType::BaseObject);
+
+			tile.fill(Qt::white);
+
+			//Setting optimizations on the painter
+			painter.begin(&tile);
+			painter.setRenderHint(QPainter::Antialiasing, true);
+			painter.setRenderHint(QPainter::TextAntialiasing, true);
+			painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
+
+			view->render(&painter, QRectF(0, 0, rect.width(), rows),
+									 QRect(rect.x(), rect.y() + y, rect.width(), rows), Qt::IgnoreAspectRatio);
+			painter.end();
+
+			png_writer.writeRows(tile, rows);
+		}
+
+		if(export_canceled)
+			png_writer.abort();
+		else
+			png_writer.close();
+	}
+	catch(Exception &e)
+	{
+		if(painter.isActive())
+			painter.end();
+
+		png_writer.abort();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
 void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename, bool show_grid, bool show_delim)
 {
 	if(!scene)
 		throw Exception(ErrorCode::AsgNotAllocattedObject,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	bool prev_show_dlm=false, prev_show_grd=false;
+	BaseObjectView::LevelOfDetail prev_lod = scene->getLevelOfDetail();
 	QSvgGenerator svg_gen;
 	QRectF scene_rect=scene->itemsBoundingRect(true, false, true), svg_rect;
 	QFileInfo fi(filename);
@@ -273,6 +373,9 @@ void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename
 	ObjectsScene::setShowGrid(show_grid);
 	ObjectsScene::setShowPageDelimiters(show_delim);
 	scene->setShowSceneLimits(false);
+	scene->setLevelOfDetail(BaseObjectView::FullDetail);
+	scene->setObjectsCacheEnabled(false);
+	scene->updatePendingRelationships();
 	scene->update();
 
 	QPainter *svg_painter = new QPainter(&svg_gen);
@@ -315,6 +418,8 @@ void ModelExportHelper::exportToSVG(ObjectsScene *scene, const QString &filename
 	ObjectsScene::setShowGrid(prev_show_grd);
 	ObjectsScene::setShowPageDelimiters(prev_show_dlm);
 	scene->setShowSceneLimits(true);
+	scene->setLevelOfDetail(prev_lod);
+	scene->setObjectsCacheEnabled(true);
 	scene->update();
 
 	if(!fi.exists() || !fi.isWritable() || !fi.isReadable())
@@ -1128,13 +1233,14 @@ void ModelExportHelper::setExportToDBMSParams(const QString &sql_buffer, Connect
 	this->errors.clear();
 }
 
-void ModelExportHelper::setExportToSQLParams(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode)
+void ModelExportHelper::setExportToSQLParams(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode, bool incremental)
 {
 	this->db_model=db_model;
 	this->filename=filename;
 	this->pgsql_ver=pgsql_ver;
 	this->split=split;
 	this->code_gen_mode=code_gen_mode;
+	this->incremental=incremental;
 }
 
 void ModelExportHelper::setExportToPNGParams(ObjectsScene *scene, QGraphicsView *viewp, const QString &filename, double zoom, bool show_grid, bool show_delim, bool page_by_page)
@@ -1220,7 +1326,7 @@ void ModelExportHelper::exportToSQL()
 {
 	try
 	{
-		exportToSQL(db_model, filename, pgsql_ver, split, code_gen_mode);
+		exportToSQL(db_model, filename, pgsql_ver, split, code_gen_mode, incremental);
 		resetExportParams();
 	}
 	catch(Exception &e)
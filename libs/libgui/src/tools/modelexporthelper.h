@@ -80,6 +80,9 @@ class __libgui ModelExportHelper: public QObject {
 		//! \brief Indicates if the data dictionary or sql export should be split into separated files
 		split,
 
+		//! \brief Indicates if the split sql export should rewrite only the changed files (see DatabaseModel::saveSplitSQLDefinition())
+		incremental,
+
 		//! \brief Indicates if the data dictionary should be browsable (include an index)
 		browsable;
 
@@ -114,6 +117,13 @@ class __libgui ModelExportHelper: public QObject {
 
 		double zoom;
 
+		//! \brief Maximum amount of memory (in bytes) used by each tile when exporting the model to a single PNG image
+		static constexpr qint64 TileMaxBytes = 64 * 1024 * 1024;
+
+		/*! \brief Renders the provided rectangle (in view coordinates) of the view in tiles streaming them
+		 *  to the PNG file, so the memory used is bounded by the tile size and not the image size */
+		void exportToTiledPNG(QGraphicsView *view, const QRect &rect, const QString &filename);
+
 		//! \brief Saves the current state of ALTER command generaton for table columns/constraints
 		void saveGenAtlerCmdsStatus(DatabaseModel *db_model);
 
@@ -159,8 +169,9 @@ class __libgui ModelExportHelper: public QObject {
 		Error catalog is available at: postgresql.org/docs/current/static/errcodes-appendix.html */
 		void setIgnoredErrors(const QStringList &err_codes);
 
-		//! \brief Exports the model to a named SQL file. The PostgreSQL version syntax must be specified.
-		void exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode);
+		/*! \brief Exports the model to a named SQL file. The PostgreSQL version syntax must be specified.
+		 * The incremental parameter is used only in split mode and causes only the changed files to be rewritten */
+		void exportToSQL(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode, bool incremental = false);
 
 		/*! \brief Exports the model to a named PNG image. The boolean parameters controls the grid exhibition
 		as well the page delimiters on the output image. The zoom parameter controls the zoom applied to the viewport
@@ -197,7 +208,7 @@ class __libgui ModelExportHelper: public QObject {
 
 		/*! \brief Configures the SQL export params before start the export thread (when in thread mode).
 		This form receive the model, output filename and pgsql version to be used */
-		void setExportToSQLParams(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode);
+		void setExportToSQLParams(DatabaseModel *db_model, const QString &filename, const QString &pgsql_ver, bool split, DatabaseModel::CodeGenMode code_gen_mode, bool incremental = false);
 
 		/*! \brief Configures the PNG export params before start the export thread (when in thread mode).
 		This form receive the objects scene, a viewport, the output filename, zoom factor, grid options and page by page export options */
@@ -18,6 +18,8 @@
 
 #include "modelsdiffhelper.h"
 #include <QThread>
+#include <QThreadPool>
+#include <QMutex>
 #include "utilsns.h"
 #include <QDate>
 #include "catalog.h"
@@ -43,6 +45,7 @@ ModelsDiffHelper::ModelsDiffHelper()
 	diff_canceled=false;
 	pgsql_version=PgSqlVersions::DefaulVersion;
 	source_model=imported_model=nullptr;
+	diff_jobs=1;
 	resetDiffCounter();
 
 	diff_opts[OptKeepClusterObjs]=true;
@@ -77,6 +80,11 @@ void ModelsDiffHelper::setPgSQLVersion(const QString pgsql_ver)
 	this->pgsql_version=pgsql_ver;
 }
 
+void ModelsDiffHelper::setDiffJobs(unsigned jobs)
+{
+	diff_jobs=(jobs==0 ? static_cast<unsigned>(QThread::idealThreadCount()) : jobs);
+}
+
 void ModelsDiffHelper::resetDiffCounter()
 {  
 	diffs_counter[ObjectsDiffInfo::AlterObject]=0;
@@ -233,6 +241,11 @@ void ModelsDiffHelper::diffModels()
 		if(!source_model || !imported_model)
 			throw Exception(ErrorCode::OprNotAllocatedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+		/* The permissions or the objects they reference may have been changed since the last diff
+		 * (e.g. permissions edited in place or objects renamed) so their similarity indexes are rebuilt */
+		source_model->invalidatePermissionsIndex();
+		imported_model->invalidatePermissionsIndex();
+
 		//First, we need to detect the objects to be dropped
 		diffModels(ObjectsDiffInfo::DropObject);
 		//Second, we will check the objects to be created or modified
@@ -378,7 +391,8 @@ void ModelsDiffHelper::diffModels(ObjectsDiffInfo::DiffType diff_type)
 		QString obj_name;
 		unsigned idx=0, factor=0, prog=0;
 		DatabaseModel *aux_model=nullptr;
-		bool objs_differs=false, xml_differs=false;
+		std::map<BaseObject *, bool> cmp_results;
+		std::map<BaseObject *, bool>::iterator cmp_itr;
 
 		if(diff_type==ObjectsDiffInfo::DropObject)
 		{
@@ -401,6 +415,11 @@ void ModelsDiffHelper::diffModels(ObjectsDiffInfo::DiffType diff_type)
 			aux_model=imported_model;
 			factor=50;
 			prog=50;
+
+			/* The most expensive part of the process, the comparison between the objects' XML code,
+			 * is made previously in parallel when more than one job is configured */
+			if(diff_jobs > 1)
+				compareObjects(obj_order, cmp_results);
 		}
 
 		for(auto &obj_itr : obj_order)
@@ -433,7 +452,7 @@ void ModelsDiffHelper::diffModels(ObjectsDiffInfo::DiffType diff_type)
 								!diff_opts[OptKeepObjectPerms]) ||
 
 							 (diff_type==ObjectsDiffInfo::CreateObject &&
-								(aux_model->getPermissionIndex(dynamic_cast<Permission *>(object), true) < 0 ||
+								(!aux_model->findPermission(dynamic_cast<Permission *>(object), true) ||
 								 !diff_opts[OptKeepObjectPerms]))))
 						generateDiffInfo(diff_type, object);
 
@@ -488,20 +507,11 @@ void ModelsDiffHelper::diffModels(ObjectsDiffInfo::DiffType diff_type)
 
 						if(diff_type != ObjectsDiffInfo::DropObject && aux_object)
 						{
-							/* Try to get a diff from the retrieve object and the current object,
-							 * comparing only basic attributes like schema, tablespace and owner
-							 * this is why the BaseObject::getAlterCode is called */
-							objs_differs=!aux_object->BaseObject::getAlterCode(object).isEmpty();
-
-							//If the objects does not differ, try to compare their XML definition
-							if(!objs_differs)
-							{
-								xml_differs = object->isCodeDiffersFrom(aux_object,	ObjectsIgnoredAttribs,
-																												obj_type != ObjectType::Role ? ObjectsIgnoredTags : RolesIgnoredTags);
-							}
+							cmp_itr=cmp_results.find(object);
 
 							//If a difference was detected between the objects
-							if(objs_differs || xml_differs)
+							if((cmp_itr!=cmp_results.end() && cmp_itr->second) ||
+								 (cmp_itr==cmp_results.end() && isObjectsDiffer(object, aux_object)))
 							{
 								generateDiffInfo(ObjectsDiffInfo::AlterObject, object, aux_object);
 
@@ -514,8 +524,6 @@ void ModelsDiffHelper::diffModels(ObjectsDiffInfo::DiffType diff_type)
 									diffTables(tab, aux_tab, ObjectsDiffInfo::DropObject);
 									diffTables(tab, aux_tab, ObjectsDiffInfo::CreateObject);
 								}
-
-								objs_differs=xml_differs=false;
 							}
 						}
 						else if(!aux_object)
@@ -559,6 +567,126 @@ void ModelsDiffHelper::diffModels(ObjectsDiffInfo::DiffType diff_type)
 	}
 }
 
+bool ModelsDiffHelper::isObjectsDiffer(BaseObject *object, BaseObject *aux_object)
+{
+	/* Try to get a diff from the retrieve object and the current object,
+	 * comparing only basic attributes like schema, tablespace and owner
+	 * this is why the BaseObject::getAlterCode is called */
+	if(!aux_object->BaseObject::getAlterCode(object).isEmpty())
+		return true;
+
+	//If the objects does not differ, try to compare their XML definition
+	return object->isCodeDiffersFrom(aux_object, ObjectsIgnoredAttribs,
+																	 object->getObjectType() != ObjectType::Role ? ObjectsIgnoredTags : RolesIgnoredTags);
+}
+
+void ModelsDiffHelper::compareObjects(const std::map<unsigned, BaseObject *> &obj_order, std::map<BaseObject *, bool> &cmp_results)
+{
+	std::vector<std::pair<BaseObject *, BaseObject *>> cmp_objs;
+	std::vector<std::pair<QString, QString>> xml_defs;
+	std::vector<char> differs;
+	std::atomic<size_t> next_idx(0);
+	QThreadPool thread_pool;
+	QMutex error_mutex;
+	Exception error;
+	bool has_error=false;
+	BaseObject *aux_object=nullptr;
+	ObjectType obj_type;
+
+	/* Gathering the pairs of objects to be compared using the same rules of diffModels().
+	 * The search for the objects in the imported model is done here in the main thread */
+	for(auto &itr : obj_order)
+	{
+		obj_type=itr.second->getObjectType();
+
+		if(obj_type==ObjectType::BaseRelationship || obj_type==ObjectType::Relationship ||
+			 obj_type==ObjectType::Permission || obj_type==ObjectType::Database ||
+			 TableObject::isTableObject(obj_type) ||
+			 itr.second->isSystemObject() || itr.second->isSQLDisabled())
+			continue;
+
+		aux_object=imported_model->getObject(itr.second->getSignature(), obj_type);
+
+		if(obj_type==ObjectType::Table && !aux_object)
+			aux_object=getRelNNTable(itr.second->getSignature(), imported_model);
+
+		if(aux_object)
+			cmp_objs.push_back({ itr.second, aux_object });
+	}
+
+	if(cmp_objs.empty())
+		return;
+
+	emit s_progressUpdated(50, tr("Comparing %1 object(s) using %2 worker thread(s)...").arg(cmp_objs.size()).arg(diff_jobs));
+
+	/* Generating the code of the objects in the main thread. The code generation writes in the attributes
+	 * and in the code cache of the objects and also of their referenced objects (e.g. two tables sharing the
+	 * same schema), so it can't be done concurrently. The worker threads will only compare the XML buffers */
+	differs.resize(cmp_objs.size(), 0);
+	xml_defs.resize(cmp_objs.size());
+
+	try
+	{
+		for(size_t idx=0; idx < cmp_objs.size() && !diff_canceled; idx++)
+		{
+			/* If the basic attributes (schema, owner, tablespace) differ there's no need to compare the XML code
+			 * (see isObjectsDiffer()) */
+			if(!cmp_objs[idx].second->BaseObject::getAlterCode(cmp_objs[idx].first).isEmpty())
+				differs[idx]=true;
+			else
+			{
+				xml_defs[idx].first=cmp_objs[idx].first->getSourceCode(SchemaParser::XmlCode);
+				xml_defs[idx].second=cmp_objs[idx].second->getSourceCode(SchemaParser::XmlCode);
+			}
+		}
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__,&e);
+	}
+
+	/* Each worker consumes the next pending pair of XML buffers and stores the result in its slot.
+	 * Since each slot is written only once the results are the same regardless the threads' scheduling */
+	thread_pool.setMaxThreadCount(diff_jobs);
+
+	for(unsigned job=0; job < diff_jobs; job++)
+	{
+		thread_pool.start([&](){
+			size_t idx=0;
+
+			while(!diff_canceled && (idx=next_idx++) < cmp_objs.size())
+			{
+				if(differs[idx])
+					continue;
+
+				try
+				{
+					differs[idx]=BaseObject::isCodeDiffersFrom(xml_defs[idx].first, xml_defs[idx].second, ObjectsIgnoredAttribs,
+																										 cmp_objs[idx].first->getObjectType() != ObjectType::Role ? ObjectsIgnoredTags : RolesIgnoredTags);
+				}
+				catch(Exception &e)
+				{
+					QMutexLocker locker(&error_mutex);
+
+					if(!has_error)
+					{
+						error=Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+						has_error=true;
+					}
+				}
+			}
+		});
+	}
+
+	thread_pool.waitForDone();
+
+	if(has_error)
+		throw Exception(error.getErrorMessage(), error.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &error);
+
+	for(size_t idx=0; idx < cmp_objs.size(); idx++)
+		cmp_results[cmp_objs[idx].first]=differs[idx];
+}
+
 void ModelsDiffHelper::diffTableObject(TableObject *tab_obj, ObjectsDiffInfo::DiffType diff_type)
 {
 	BaseTable *base_tab=nullptr, *aux_base_tab=nullptr;
@@ -26,6 +26,7 @@
 #define MODELS_DIFF_HELPER_H
 
 #include <QObject>
+#include <atomic>
 #include "databasemodel.h"
 #include "objectsdiffinfo.h"
 
@@ -51,15 +52,19 @@ class __libgui ModelsDiffHelper: public QObject {
 		//! \brief PostgreSQL version used to generate the diff
 		pgsql_version;
 
-		//! \brief Indicates if the diff was cancelled by user
-		bool diff_canceled,
+		/*! \brief Indicates if the diff was cancelled by user. This flag is atomic because it
+		 * is read by the worker threads started in compareObjects() */
+		std::atomic<bool> diff_canceled;
 
 		//!brief Diff options. See OPT_??? constants
-		diff_opts[10];
+		bool diff_opts[10];
 
 		//! \brief Stores the count of objects to be dropped, changed or created
 		unsigned diffs_counter[4];
 
+		//! \brief Amount of worker threads used to compare the objects of both models
+		unsigned diff_jobs;
+
 		//! \brief Reference model from which all changes are generated
 		DatabaseModel *source_model,
 
@@ -84,6 +89,17 @@ class __libgui ModelsDiffHelper: public QObject {
 		//! \brief Compares the two models storing the diff between them in the diff_infos vector.
 		void diffModels(ObjectsDiffInfo::DiffType diff_type);
 
+		/*! \brief Returns if the object differs from the aux_object by comparing their basic attributes
+		 * (schema, owner, tablespace) and, if needed, their XML code */
+		bool isObjectsDiffer(BaseObject *object, BaseObject *aux_object);
+
+		/*! \brief Does the same as isObjectsDiffer() for all the objects in the provided list that have a counterpart
+		 * in the imported model spreading the XML comparisons between diff_jobs worker threads. All the code generation,
+		 * which changes the state of the objects and of their referenced objects (schema, owner, etc), is done in the
+		 * calling thread, so the workers only handle the generated buffers. The results are stored in the cmp_results
+		 * map, so diffModels() can consume them in the creation order of the objects */
+		void compareObjects(const std::map<unsigned, BaseObject *> &obj_order, std::map<BaseObject *, bool> &cmp_results);
+
 		/*! \brief Compares the specified table object against the ones on the source model or imported
 		model depending on the diff_type parameter. */
 		void diffTableObject(TableObject *tab_obj, ObjectsDiffInfo::DiffType diff_type);
@@ -183,6 +199,10 @@ class __libgui ModelsDiffHelper: public QObject {
 		//! \brief Configures the PostgreSQL version used in the diff generation
 		void setPgSQLVersion(const QString pgsql_ver);
 
+		/*! \brief Configures the amount of worker threads used to compare the objects of both models.
+		 * Zero means one thread per available CPU core. The default is 1 (no parallel comparison) */
+		void setDiffJobs(unsigned jobs);
+
 		//! \brief Returns the count of diff infos of the specified diff_type
 		unsigned getDiffTypeCount(ObjectsDiffInfo::DiffType diff_type);
 
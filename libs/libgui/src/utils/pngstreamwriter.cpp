@@ -0,0 +1,239 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "pngstreamwriter.h"
+#include "exception.h"
+#include <QtEndian>
+
+PngStreamWriter::PngStreamWriter()
+{
+	zstream_init = false;
+	rows_written = 0;
+}
+
+PngStreamWriter::~PngStreamWriter()
+{
+	if(isOpen())
+		abort();
+}
+
+void PngStreamWriter::writeChunk(const char *type, const char *data, unsigned len)
+{
+	uchar len_buf[4];
+	uLong crc = crc32(0L, Z_NULL, 0);
+
+	qToBigEndian<quint32>(len, len_buf);
+	crc = crc32(crc, reinterpret_cast<const Bytef *>(type), 4);
+
+	if(len > 0)
+		crc = crc32(crc, reinterpret_cast<const Bytef *>(data), len);
+
+	QByteArray chunk;
+	uchar crc_buf[4];
+
+	qToBigEndian<quint32>(crc, crc_buf);
+	chunk.reserve(len + 12);
+	chunk.append(reinterpret_cast<const char *>(len_buf), 4);
+	chunk.append(type, 4);
+	chunk.append(data, len);
+	chunk.append(reinterpret_cast<const char *>(crc_buf), 4);
+
+	if(output.write(chunk) != chunk.size())
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(output.fileName()),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__, nullptr, output.errorString());
+}
+
+void PngStreamWriter::deflateData(const char *data, unsigned len, bool finish)
+{
+	int res = Z_OK;
+
+	zstream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+	zstream.avail_in = len;
+
+	do
+	{
+		res = deflate(&zstream, finish ? Z_FINISH : Z_NO_FLUSH);
+
+		if(res == Z_STREAM_ERROR)
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(output.fileName()),
+											ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__, nullptr,
+											zstream.msg ? QString(zstream.msg) : QString());
+
+		//The buffer is full (or the stream was terminated) so we flush it as an IDAT chunk
+		if(zstream.avail_out == 0 || (finish && res == Z_STREAM_END))
+		{
+			unsigned size = ChunkBufferSize - zstream.avail_out;
+
+			if(size > 0)
+				writeChunk("IDAT", chunk_buffer.constData(), size);
+
+			zstream.next_out = reinterpret_cast<Bytef *>(chunk_buffer.data());
+			zstream.avail_out = ChunkBufferSize;
+		}
+	}
+	while(zstream.avail_in > 0 || (finish && res != Z_STREAM_END));
+}
+
+void PngStreamWriter::reset()
+{
+	if(zstream_init)
+		deflateEnd(&zstream);
+
+	zstream_init = false;
+	rows_written = 0;
+	img_size = QSize();
+	chunk_buffer.clear();
+	row_buffer.clear();
+	output.close();
+}
+
+void PngStreamWriter::open(const QString &filename, const QSize &size)
+{
+	if(isOpen())
+		abort();
+
+	if(size.isEmpty())
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	output.setFileName(filename);
+
+	if(!output.open(QFile::WriteOnly | QFile::Truncate))
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+										ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__, nullptr, output.errorString());
+
+	try
+	{
+		static const char signature[] = { '\x89', 'P', 'N', 'G', '\r', '\n', '\x1a', '\n' };
+		uchar ihdr[13];
+
+		if(output.write(signature, sizeof(signature)) != sizeof(signature))
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+											ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__, nullptr, output.errorString());
+
+		//Header: width, height, bit depth (8), color type (2 = RGB), compression, filter and interlace methods (0)
+		qToBigEndian<quint32>(size.width(), ihdr);
+		qToBigEndian<quint32>(size.height(), ihdr + 4);
+		ihdr[8] = 8;
+		ihdr[9] = 2;
+		ihdr[10] = ihdr[11] = ihdr[12] = 0;
+		writeChunk("IHDR", reinterpret_cast<const char *>(ihdr), sizeof(ihdr));
+
+		zstream.zalloc = Z_NULL;
+		zstream.zfree = Z_NULL;
+		zstream.opaque = Z_NULL;
+
+		if(deflateInit(&zstream, Z_DEFAULT_COMPRESSION) != Z_OK)
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+											ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		zstream_init = true;
+		chunk_buffer.resize(ChunkBufferSize);
+		zstream.next_out = reinterpret_cast<Bytef *>(chunk_buffer.data());
+		zstream.avail_out = ChunkBufferSize;
+
+		//Each row starts with the filter type byte (0 = none) followed by the RGB triplets
+		row_buffer.resize(1 + (size.width() * 3));
+		img_size = size;
+		rows_written = 0;
+	}
+	catch(Exception &e)
+	{
+		abort();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void PngStreamWriter::writeRows(const QImage &img, int row_count)
+{
+	if(!isOpen() || img.isNull() || img.width() != img_size.width())
+		throw Exception(Exception::getErrorMessage(ErrorCode::FileNotWrittenInvalidDefinition).arg(output.fileName()),
+										ErrorCode::FileNotWrittenInvalidDefinition,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	if(row_count < 0 || row_count > img.height())
+		row_count = img.height();
+
+	//Avoiding writing more rows than the declared image height
+	row_count = std::min(row_count, img_size.height() - rows_written);
+
+	QImage rgb_img = img.format() == QImage::Format_RGB888 ? img : img.convertToFormat(QImage::Format_RGB888);
+	unsigned row_len = img_size.width() * 3;
+
+	try
+	{
+		row_buffer[0] = 0;
+
+		for(int row = 0; row < row_count; row++)
+		{
+			memcpy(row_buffer.data() + 1, rgb_img.constScanLine(row), row_len);
+			deflateData(row_buffer.constData(), row_buffer.size(), false);
+		}
+
+		rows_written += row_count;
+	}
+	catch(Exception &e)
+	{
+		abort();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void PngStreamWriter::close()
+{
+	if(!isOpen())
+		return;
+
+	QString filename = output.fileName();
+
+	try
+	{
+		if(rows_written != img_size.height())
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileNotWrittenInvalidDefinition).arg(filename),
+											ErrorCode::FileNotWrittenInvalidDefinition,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+		deflateData(nullptr, 0, true);
+		writeChunk("IEND", nullptr, 0);
+
+		if(!output.flush())
+			throw Exception(Exception::getErrorMessage(ErrorCode::FileDirectoryNotWritten).arg(filename),
+											ErrorCode::FileDirectoryNotWritten,__PRETTY_FUNCTION__,__FILE__,__LINE__, nullptr, output.errorString());
+
+		reset();
+	}
+	catch(Exception &e)
+	{
+		abort();
+		throw Exception(e.getErrorMessage(), e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void PngStreamWriter::abort()
+{
+	QString filename = output.fileName();
+	bool opened = output.isOpen();
+
+	reset();
+
+	if(opened)
+		QFile::remove(filename);
+}
+
+bool PngStreamWriter::isOpen()
+{
+	return output.isOpen();
+}
@@ -0,0 +1,95 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup libgui
+\class PngStreamWriter
+\brief Writes a PNG image row by row so huge images can be generated without
+allocating the whole image in memory. The rows are compressed and flushed to
+the output file as they are appended, so the memory used is bounded by the
+size of the images passed to writeRows()
+*/
+
+#ifndef PNG_STREAM_WRITER_H
+#define PNG_STREAM_WRITER_H
+
+#include "guiglobal.h"
+#include <QFile>
+#include <QImage>
+#include <zlib.h>
+
+class __libgui PngStreamWriter {
+	private:
+		//! \brief Size of the buffer that holds compressed data before writing an IDAT chunk
+		static constexpr int ChunkBufferSize = 65536;
+
+		//! \brief Output file
+		QFile output;
+
+		//! \brief Deflate stream used to compress the image rows
+		z_stream zstream;
+
+		//! \brief Indicates that the deflate stream was initialized
+		bool zstream_init;
+
+		//! \brief Dimensions of the image being written
+		QSize img_size;
+
+		//! \brief Amount of rows already written to the image
+		int rows_written;
+
+		//! \brief Buffer that receives the compressed data
+		QByteArray chunk_buffer;
+
+		//! \brief Buffer used to assemble a single filtered row (filter byte + RGB pixels)
+		QByteArray row_buffer;
+
+		//! \brief Writes a chunk (length, type, data and CRC) into the output file
+		void writeChunk(const char *type, const char *data, unsigned len);
+
+		/*! \brief Compresses the provided data writing IDAT chunks as the buffer gets full.
+		 *  When finish is true the deflate stream is terminated */
+		void deflateData(const char *data, unsigned len, bool finish);
+
+		//! \brief Releases the deflate stream and closes the output file
+		void reset();
+
+	public:
+		PngStreamWriter();
+		~PngStreamWriter();
+
+		/*! \brief Creates the output file and writes the PNG header for an RGB image with the provided size.
+		 *  Raises an error if the file can't be written */
+		void open(const QString &filename, const QSize &size);
+
+		/*! \brief Appends the first row_count rows of the provided image (which must have the same width as
+		 *  the output image) to the output. When row_count is negative all the rows are written */
+		void writeRows(const QImage &img, int row_count = -1);
+
+		/*! \brief Finishes the image and closes the output file. Raises an error if the amount of rows
+		 *  written is different from the height of the image */
+		void close();
+
+		//! \brief Discards the image being written, removing the incomplete output file
+		void abort();
+
+		//! \brief Returns if an image is being written
+		bool isOpen();
+};
+
+#endif
@@ -46,6 +46,8 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 	connect(objectstree_tw, &QTreeWidget::itemPressed, this, &ModelObjectsWidget::selectObject);
 	connect(objectstree_tw, &QTreeWidget::itemPressed, this, &ModelObjectsWidget::showObjectMenu);
 
+	connect(objectstree_tw, &QTreeWidget::itemExpanded, this, &ModelObjectsWidget::populateTreeItem);
+
 	connect(objectstree_tw, &QTreeWidget::itemCollapsed, this, [this](){
 		objectstree_tw->resizeColumnToContents(0);
 	});
@@ -60,6 +62,7 @@ ModelObjectsWidget::ModelObjectsWidget(bool simplified_view, QWidget *parent) :
 	connect(objectslist_tbw, &QTableWidget::itemSelectionChanged, this, &ModelObjectsWidget::selectObject);
 
 	connect(expand_all_tb, &QToolButton::clicked,  this, [this](){
+		populateAllTreeItems();
 		objectstree_tw->blockSignals(true);
 		objectstree_tw->expandAll();
 		objectstree_tw->blockSignals(false);
@@ -232,7 +235,10 @@ void ModelObjectsWidget::selectObject()
 				p_act = model_wgt->rels_menu->menuAction();
 
 			if(simplified_view && enable_obj_creation)
+			{
 				connect(model_wgt->getDatabaseModel(), &DatabaseModel::s_objectAdded, this, &ModelObjectsWidget::selectCreatedObject, Qt::QueuedConnection);
+				connect(model_wgt->getDatabaseModel(), &DatabaseModel::s_objectsAdded, this, &ModelObjectsWidget::selectCreatedObjects, Qt::QueuedConnection);
+			}
 
 			p_act->setIcon(QIcon(GuiUtilsNs::getIconPath(obj_type)));
 			p_act->setText(tr("New") + " " + BaseObject::getTypeName(obj_type));
@@ -277,9 +283,29 @@ QVariant ModelObjectsWidget::generateItemValue(BaseObject *object)
 	return QVariant::fromValue(reinterpret_cast<void *>(object));
 }
 
-QTreeWidgetItem *ModelObjectsWidget::createItemForObject(BaseObject *object, QTreeWidgetItem *root, bool update_perms)
+QTreeWidgetItem *ModelObjectsWidget::createItemForObject(BaseObject *object, QTreeWidgetItem *root, bool has_children)
 {
 	QTreeWidgetItem *item=nullptr;
+
+	if(!object)
+		throw Exception(ErrorCode::OprNotAllocatedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
+
+	item=new QTreeWidgetItem(root);
+	item->setData(0, Qt::UserRole, generateItemValue(object));
+	configureItem(item, object);
+
+	/* The child items (groups, permissions, etc) are only created when the item is expanded
+	 * for the first time, so we just show the expansion indicator here */
+	if(has_children && hasChildItems(object))
+		item->setChildIndicatorPolicy(QTreeWidgetItem::ShowIndicator);
+	else
+		item->setData(0, PopulatedRole, true);
+
+	return item;
+}
+
+void ModelObjectsWidget::configureItem(QTreeWidgetItem *item, BaseObject *object)
+{
 	QFont font;
 	QString str_aux;
 	BaseRelationship::RelType rel_type;
@@ -288,25 +314,22 @@ QTreeWidgetItem *ModelObjectsWidget::createItemForObject(BaseObject *object, QTr
 	TableObject *tab_obj=nullptr;
 	QString obj_name;
 
-	if(!object)
+	if(!item || !object)
 		throw Exception(ErrorCode::OprNotAllocatedObject ,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
 	obj_type=object->getObjectType();
 	tab_obj=dynamic_cast<TableObject *>(object);
-	item=new QTreeWidgetItem(root);
 
 	if(obj_type==ObjectType::Function)
 	{
 		Function *func=dynamic_cast<Function *>(object);
 		func->createSignature(false);
-		item->setText(0,func->getSignature());
 		obj_name=func->getSignature();
 		func->createSignature(true);
 	}
 	else if(obj_type==ObjectType::Operator)
 	{
 		Operator *oper=dynamic_cast<Operator *>(object);
-		item->setText(0, oper->getSignature(false));
 		obj_name=oper->getSignature(false);
 	}
 	else if(obj_type==ObjectType::OpClass || obj_type == ObjectType::OpFamily)
@@ -314,23 +337,17 @@ QTreeWidgetItem *ModelObjectsWidget::createItemForObject(BaseObject *object, QTr
 		obj_name=object->getSignature(false);
 		obj_name.replace(QRegularExpression("( )+(USING)( )+"), " [");
 		obj_name+=QChar(']');
-		item->setText(0,obj_name);
 	}
 	else
-	{
-		item->setText(0,object->getName());
 		obj_name=object->getName();
-	}
 
+	item->setText(0, obj_name);
 	item->setToolTip(0, QString("%1 (id: %2)").arg(obj_name).arg(object->getObjectId()));
-	item->setData(0, Qt::UserRole, generateItemValue(object));
 	item->setText(1, QString::number(object->getObjectId()));
 
-	if(update_perms)
-		updatePermissionTree(item, object);
-
 	font=item->font(0);
 	font.setStrikeOut(object->isSQLDisabled() && !object->isSystemObject());
+	font.setItalic(false);
 
 	if(tab_obj && tab_obj->isAddedByRelationship())
 	{
@@ -342,6 +359,9 @@ QTreeWidgetItem *ModelObjectsWidget::createItemForObject(BaseObject *object, QTr
 		font.setItalic(true);
 		item->setForeground(0, ObjectsTableWidget::getTableItemColor(ObjectsTableWidget::ProtItemAltFgColor));
 	}
+	else
+		//Resets the foreground color in case the item is being updated
+		item->setData(0, Qt::ForegroundRole, QVariant());
 
 	item->setFont(0,font);
 
@@ -384,10 +404,234 @@ QTreeWidgetItem *ModelObjectsWidget::createItemForObject(BaseObject *object, QTr
 	}
 
 	item->setIcon(0, QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(obj_type) + str_aux)));
+}
+
+QTreeWidgetItem *ModelObjectsWidget::createGroupItem(ObjectType obj_type, QTreeWidgetItem *root)
+{
+	QTreeWidgetItem *item=new QTreeWidgetItem(root);
+	QFont font=item->font(0);
+
+	item->setIcon(0,QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(obj_type))));
+	font.setItalic(true);
+	item->setFont(0, font);
+
+	item->setData(0, GroupTypeRole, QVariant(enum_t(obj_type)));
+	item->setData(0, PopulatedRole, true);
+
+	/* The groups of table children don't carry the object type on the column 1
+	 * so they don't expose the popup menu "New [OBJECT]" (see selectObject()) */
+	if(!TableObject::isTableObject(obj_type))
+		item->setData(1, Qt::UserRole, QVariant(enum_t(obj_type)));
 
 	return item;
 }
 
+bool ModelObjectsWidget::hasChildItems(BaseObject *object)
+{
+	if(!object)
+		return false;
+
+	return object->getObjectType() == ObjectType::Tag ||
+				 !getChildGroupTypes(object).empty() ||
+				 (visible_objs_map[ObjectType::Permission] && Permission::acceptsPermission(object->getObjectType()));
+}
+
+std::vector<ObjectType> ModelObjectsWidget::getChildGroupTypes(BaseObject *object)
+{
+	std::vector<ObjectType> types, vis_types;
+	ObjectType obj_type = object->getObjectType();
+
+	if(obj_type == ObjectType::Tag)
+		return vis_types;
+
+	types = BaseObject::getChildObjectTypes(obj_type);
+
+	if(obj_type == ObjectType::Database)
+		types.insert(types.end(), { ObjectType::Tag, ObjectType::GenericSql, ObjectType::Textbox, ObjectType::Relationship });
+
+	for(auto &type : types)
+	{
+		if(visible_objs_map[type])
+			vis_types.push_back(type);
+	}
+
+	return vis_types;
+}
+
+std::vector<BaseObject *> ModelObjectsWidget::getChildObjects(BaseObject *parent, ObjectType obj_type)
+{
+	std::vector<BaseObject *> obj_list;
+	ObjectType parent_type = parent->getObjectType();
+
+	if(parent_type == ObjectType::Database)
+	{
+		obj_list = *db_model->getObjectList(obj_type);
+
+		//Special case for relationship, merging the base relationship list to the relationship list
+		if(obj_type == ObjectType::Relationship)
+		{
+			std::vector<BaseObject *> *obj_list_aux = db_model->getObjectList(ObjectType::BaseRelationship);
+			obj_list.insert(obj_list.end(), obj_list_aux->begin(), obj_list_aux->end());
+		}
+	}
+	else if(parent_type == ObjectType::Schema)
+		obj_list = db_model->getObjects(obj_type, parent);
+	else if(BaseTable::isBaseTable(parent_type))
+	{
+		std::vector<TableObject *> *tab_objs = nullptr;
+
+		if(parent_type == ObjectType::View)
+			tab_objs = dynamic_cast<View *>(parent)->getObjectList(obj_type);
+		else
+			tab_objs = dynamic_cast<PhysicalTable *>(parent)->getObjectList(obj_type);
+
+		if(tab_objs)
+			obj_list.assign(tab_objs->begin(), tab_objs->end());
+	}
+	else if(parent_type == ObjectType::Tag)
+		db_model->getObjectReferences(parent, obj_list);
+
+	return obj_list;
+}
+
+void ModelObjectsWidget::updateObjectItems(QTreeWidgetItem *root, const std::vector<BaseObject *> &obj_list, bool has_children)
+{
+	std::map<BaseObject *, QTreeWidgetItem *> items;
+	std::map<BaseObject *, QTreeWidgetItem *>::iterator itr;
+	QTreeWidgetItem *item = nullptr;
+
+	/* Mapping the items currently in the tree. Note that the object references stored in these
+	 * items are used only as keys since some of them may refer to objects already destroyed */
+	for(int idx = 0; idx < root->childCount(); idx++)
+	{
+		item = root->child(idx);
+		items[reinterpret_cast<BaseObject *>(item->data(0, Qt::UserRole).value<void *>())] = item;
+	}
+
+	for(auto &obj : obj_list)
+	{
+		itr = items.find(obj);
+
+		if(itr == items.end())
+		{
+			createItemForObject(obj, root, has_children);
+			continue;
+		}
+
+		item = itr->second;
+		items.erase(itr);
+		configureItem(item, obj);
+
+		//Only the items already expanded once have their children updated
+		if(has_children && item->data(0, PopulatedRole).toBool())
+			updateChildItems(item);
+	}
+
+	//Destroying the items of the objects that aren't in the parent anymore
+	for(auto &itr : items)
+		delete itr.second;
+}
+
+void ModelObjectsWidget::updateChildItems(QTreeWidgetItem *item)
+{
+	BaseObject *object = reinterpret_cast<BaseObject *>(item->data(0, Qt::UserRole).value<void *>());
+	std::map<ObjectType, QTreeWidgetItem *> groups;
+	std::map<ObjectType, QTreeWidgetItem *>::iterator itr;
+	std::vector<BaseObject *> obj_list;
+	QTreeWidgetItem *child = nullptr, *group_item = nullptr;
+
+	if(!object)
+		return;
+
+	try
+	{
+		item->setData(0, PopulatedRole, true);
+		item->setChildIndicatorPolicy(QTreeWidgetItem::DontShowIndicatorWhenChildless);
+
+		//Tags have the objects that reference them as direct children
+		if(object->getObjectType() == ObjectType::Tag)
+		{
+			updateObjectItems(item, getChildObjects(object, ObjectType::Tag), false);
+			return;
+		}
+
+		updatePermissionTree(item, object);
+
+		for(int idx = 0; idx < item->childCount(); idx++)
+		{
+			child = item->child(idx);
+
+			if(child->data(0, GroupTypeRole).isValid())
+				groups[static_cast<ObjectType>(child->data(0, GroupTypeRole).toUInt())] = child;
+		}
+
+		for(auto &type : getChildGroupTypes(object))
+		{
+			itr = groups.find(type);
+
+			if(itr == groups.end())
+				group_item = createGroupItem(type, item);
+			else
+			{
+				group_item = itr->second;
+				groups.erase(itr);
+			}
+
+			obj_list = getChildObjects(object, type);
+			updateObjectItems(group_item, obj_list, true);
+			group_item->setText(0, QString("%1 (%2)").arg(BaseObject::getTypeName(type)).arg(obj_list.size()));
+		}
+
+		//Removing the groups of the object types that were hidden
+		for(auto &itr : groups)
+			delete itr.second;
+	}
+	catch(Exception &e)
+	{
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
+}
+
+void ModelObjectsWidget::populateTreeItem(QTreeWidgetItem *item)
+{
+	if(!item || item->data(0, PopulatedRole).toBool())
+		return;
+
+	try
+	{
+		updateChildItems(item);
+		item->sortChildren(0, Qt::AscendingOrder);
+	}
+	catch(Exception &e)
+	{
+		Messagebox msg_box;
+		msg_box.show(e);
+	}
+}
+
+void ModelObjectsWidget::populateAllTreeItems()
+{
+	std::vector<QTreeWidgetItem *> items;
+	QTreeWidgetItem *item = nullptr;
+
+	for(int idx = 0; idx < objectstree_tw->topLevelItemCount(); idx++)
+		items.push_back(objectstree_tw->topLevelItem(idx));
+
+	while(!items.empty())
+	{
+		item = items.back();
+		items.pop_back();
+
+		if(!item->data(0, PopulatedRole).toBool())
+			updateChildItems(item);
+
+		for(int idx = 0; idx < item->childCount(); idx++)
+			items.push_back(item->child(idx));
+	}
+
+	objectstree_tw->sortByColumn(0, Qt::AscendingOrder);
+}
+
 void ModelObjectsWidget::setObjectVisible(ObjectType obj_type, bool visible)
 {
 	if(obj_type!=ObjectType::BaseObject && obj_type!=ObjectType::BaseTable)
@@ -429,6 +673,14 @@ void ModelObjectsWidget::changeObjectsView()
 		tree_view_tb->setChecked(sender()==tree_view_tb);
 		list_view_tb->setChecked(sender()==list_view_tb);
 		by_id_chk->setEnabled(sender()==tree_view_tb);
+
+		if(list_view_tb->isChecked())
+		{
+			updateObjectsList();
+
+			if(!filter_edt->text().isEmpty())
+				filterObjects();
+		}
 	}
 	else if(sender()==options_tb)
 	{
@@ -458,6 +710,10 @@ void ModelObjectsWidget::filterObjects()
 {
 	if(tree_view_tb->isChecked())
 	{
+		//The items not created yet need to be created so they can be found by the filter
+		if(!filter_edt->text().isEmpty())
+			populateAllTreeItems();
+
 		DatabaseImportForm::filterObjects(objectstree_tw, filter_edt->text(), (by_id_chk->isChecked() ? 1 : 0), simplified_view);
 	}
 	else
@@ -482,7 +738,12 @@ void ModelObjectsWidget::updateObjectsView()
 {
 	selected_objs.clear();
 	updateDatabaseTree();
-	updateObjectsList();
+
+	//The objects list is only updated when visible, see changeObjectsView()
+	if(list_view_tb->isChecked())
+		updateObjectsList();
+	else
+		objectslist_tbw->setRowCount(0);
 
 	if(!filter_edt->text().isEmpty())
 		filterObjects();
@@ -509,239 +770,46 @@ void ModelObjectsWidget::updateObjectsList()
 	objectslist_tbw->clearSelection();
 }
 
-void ModelObjectsWidget::updateSchemaTree(QTreeWidgetItem *root)
-{
-	if(db_model && visible_objs_map[ObjectType::Schema])
-	{
-		BaseObject *schema=nullptr;
-		std::vector<BaseObject *> obj_list;
-		QFont font;
-		QTreeWidgetItem *item=nullptr, *item1=nullptr, *item2=nullptr, *item3=nullptr;
-		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(ObjectType::Schema);
-		int count = 0, count2 = 0, i = 0;
-		QPixmap group_icon=QPixmap(GuiUtilsNs::getIconPath(QString(BaseObject::getSchemaName(ObjectType::Schema))));
-
-		//Removing the ObjectType::Table and ObjectType::View types since they are handled separetedly
-		types.erase(std::find(types.begin(), types.end(), ObjectType::Table));
-		types.erase(std::find(types.begin(), types.end(), ObjectType::ForeignTable));
-		types.erase(std::find(types.begin(), types.end(), ObjectType::View));
-
-		//Get the current schema count on database
-		count=(db_model->getObjectCount(ObjectType::Schema));
-		item=new QTreeWidgetItem(root);
-		item->setIcon(0,group_icon);
-		item->setData(1, Qt::UserRole, QVariant(enum_t(ObjectType::Schema)));
-
-		//Create the schema group item
-		item->setText(0, QString("%1 (%2)").arg(BaseObject::getTypeName(ObjectType::Schema)).arg(count));
-		font=item->font(0);
-		font.setItalic(true);
-		item->setFont(0, font);
-
-		try
-		{
-			for(i=0; i < count; i++)
-			{
-				//The first item is the public schema
-				if(i==-1)
-				{
-					//The new sub item to be configured will be the public schema item
-					item2=item1;
-					schema=nullptr;
-				}
-				else
-				{
-					schema=db_model->getObject(i, ObjectType::Schema);
-					item2=createItemForObject(schema, item);
-				}
-
-				//Updates the table subtree for the current schema
-				updateTableTree(item2, schema, ObjectType::Table);
-
-				//Updates the foreign table subtree for the current schema
-				updateTableTree(item2, schema, ObjectType::ForeignTable);
-
-				//Updates the view subtree for the current schema
-				updateViewTree(item2, schema);
-
-				//Creates the object group at schema level (function, domain, sequences, etc)
-				for(auto type : types)
-				{
-					if(visible_objs_map[type])
-					{
-						item3=new QTreeWidgetItem(item2);
-						item3->setIcon(0,QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(type))));
-
-						//Get the objects that belongs to the current schema
-						obj_list=db_model->getObjects(type, schema);
-
-						count2=obj_list.size();
-						item3->setText(0, QString("%1 (%2)").arg(BaseObject::getTypeName(type)).arg(count2));
-						item3->setData(1, Qt::UserRole, QVariant(enum_t(type)));
-
-						font=item3->font(0);
-						font.setItalic(true);
-						item3->setFont(0, font);
-
-						for(auto obj : obj_list)
-							createItemForObject(obj, item3);
-					}
-				}
-			}
-		}
-		catch(Exception &e)
-		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-		}
-	}
-}
-
-void ModelObjectsWidget::updateTableTree(QTreeWidgetItem *root, BaseObject *schema, ObjectType table_type)
-{
-	if(db_model && PhysicalTable::isPhysicalTable(table_type) && visible_objs_map[table_type])
-	{
-		std::vector<BaseObject *> obj_list;
-		PhysicalTable *table=nullptr;
-		QTreeWidgetItem *item=nullptr, *item1=nullptr, *item2=nullptr;
-		QFont font;
-		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(table_type);
-		QPixmap group_icon=QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(table_type)));
-
-		try
-		{
-			//Get all tables that belongs to the specified schema
-			obj_list=db_model->getObjects(table_type, schema);
-
-			//Create a table group item
-			item=new QTreeWidgetItem(root);
-			item->setIcon(0,group_icon);
-			item->setText(0,BaseObject::getTypeName(table_type) +
-						  QString(" (%1)").arg(obj_list.size()));
-			item->setData(1, Qt::UserRole, QVariant(enum_t(table_type)));
-
-			font=item->font(0);
-			font.setItalic(true);
-			item->setFont(0, font);
-
-			for(auto obj : obj_list)
-			{
-				table=dynamic_cast<PhysicalTable *>(obj);
-				item1=createItemForObject(table, item);
-
-				//Creating the group for the child objects (column, rules, triggers, indexes and constraints)
-				for(auto type : types)
-				{
-					if(visible_objs_map[type])
-					{
-						item2=new QTreeWidgetItem(item1);
-						item2->setIcon(0,QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(type))));
-						font=item2->font(0);
-						font.setItalic(true);
-						item2->setFont(0, font);
-
-						item2->setText(0, QString("%1 (%2)").arg(BaseObject::getTypeName(type)).arg(table->getObjectCount(type)));
-
-						for(auto tab_obj : *table->getObjectList(type))
-							createItemForObject(tab_obj, item2);
-					}
-				}
-			}
-		}
-		catch(Exception &e)
-		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
-		}
-	}
-}
-
-void ModelObjectsWidget::updateViewTree(QTreeWidgetItem *root, BaseObject *schema)
+void ModelObjectsWidget::updatePermissionTree(QTreeWidgetItem *root, BaseObject *object)
 {
-	if(db_model && visible_objs_map[ObjectType::View])
+	try
 	{
-		BaseObject *object=nullptr;
-		std::vector<BaseObject *> obj_list;
-		View *view=nullptr;
-		QTreeWidgetItem *item=nullptr, *item1=nullptr, *item2=nullptr;
-		QFont font;
-		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(ObjectType::View);
-		int count = 0, count1 = 0, i = 0, i2 = 0;
-		QPixmap group_icon=QPixmap(GuiUtilsNs::getIconPath(QString(BaseObject::getSchemaName(ObjectType::View))));
-
-		try
-		{
-			//Get all views that belongs to the specified schema
-			obj_list=db_model->getObjects(ObjectType::View, schema);
-
-			//Create a table group item
-			item=new QTreeWidgetItem(root);
-			item->setIcon(0,group_icon);
-			item->setText(0,BaseObject::getTypeName(ObjectType::View) + QString(" (%1)").arg(obj_list.size()));
-			item->setData(1, Qt::UserRole, QVariant(enum_t(ObjectType::View)));
-
-			font=item->font(0);
-			font.setItalic(true);
-			item->setFont(0, font);
-
-			count=obj_list.size();
+		QTreeWidgetItem *item=nullptr;
 
-			for(i=0; i < count; i++)
-			{
-				view=dynamic_cast<View *>(obj_list[i]);
-				item1=createItemForObject(view, item);
-
-				//Creating the group for the child objects (rules, triggers)
-				for(auto &type : types)
-				{
-					if(visible_objs_map[type])
-					{
-						item2=new QTreeWidgetItem(item1);
-						item2->setIcon(0,QPixmap(GuiUtilsNs::getIconPath(BaseObject::getSchemaName(type))));
-						font=item2->font(0);
-						font.setItalic(true);
-						item2->setFont(0, font);
-
-						count1 = view->getObjectCount(type);
-						item2->setText(0,BaseObject::getTypeName(type) + QString(" (%1)").arg(count1));
-
-						for(i2=0; i2 < count1; i2++)
-						{
-							object=view->getObject(i2, type);
-							createItemForObject(object, item2);
-						}
-					}
-				}
-			}
-		}
-		catch(Exception &e)
+		//Locating the current permission group item of the object (if any)
+		for(int idx = 0; idx < root->childCount() && !item; idx++)
 		{
-			throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+			if(!root->child(idx)->data(0, GroupTypeRole).isValid() &&
+				 root->child(idx)->data(1, Qt::UserRole).toUInt() == enum_t(ObjectType::Permission))
+				item = root->child(idx);
 		}
-	}
-}
 
-void ModelObjectsWidget::updatePermissionTree(QTreeWidgetItem *root, BaseObject *object)
-{
-	try
-	{
 		if(db_model && visible_objs_map[ObjectType::Permission] &&
 				Permission::acceptsPermission(object->getObjectType()))
 		{
 			std::vector<Permission *> perms;
-			QTreeWidgetItem *item=new QTreeWidgetItem(root);
-			QFont font=item->font(0);
 
-			db_model->getPermissions(object, perms);
-			item->setIcon(0,QPixmap(GuiUtilsNs::getIconPath("permission")));
+			if(!item)
+			{
+				QFont font;
+
+				item=new QTreeWidgetItem(root);
+				font=item->font(0);
+				item->setIcon(0,QPixmap(GuiUtilsNs::getIconPath("permission")));
+				font.setItalic(true);
+				item->setFont(0, font);
+				item->setData(0, Qt::UserRole, generateItemValue(object));
+				item->setData(0, PopulatedRole, true);
+				item->setData(1, Qt::UserRole, static_cast<unsigned>(ObjectType::Permission));
+			}
 
-			font.setItalic(true);
-			item->setFont(0, font);
+			db_model->getPermissions(object, perms);
 			item->setText(0, QString("%1 (%2)")
 							.arg(BaseObject::getTypeName(ObjectType::Permission))
 						  .arg(perms.size()));
-
-			item->setData(0, Qt::UserRole, generateItemValue(object));
-			item->setData(1, Qt::UserRole, static_cast<unsigned>(ObjectType::Permission));
 		}
+		else if(item)
+			delete item;
 	}
 	catch(Exception &e)
 	{
@@ -751,80 +819,31 @@ void ModelObjectsWidget::updatePermissionTree(QTreeWidgetItem *root, BaseObject
 
 void ModelObjectsWidget::updateDatabaseTree()
 {
-	if(!db_model)
+	if(!db_model || !visible_objs_map[ObjectType::Database])
 		objectstree_tw->clear();
 	else
 	{
-		QString str_aux;
-		BaseObject *object=nullptr;
-		QTreeWidgetItem *root=nullptr,*item1=nullptr, *item2=nullptr;
-		QFont font;
-		std::vector<BaseObject *> ref_list, tree_state, obj_list;
-		std::vector<ObjectType> types = BaseObject::getChildObjectTypes(ObjectType::Database);
-		unsigned count = 0, i = 0, i1 = 0;
-
-		types.push_back(ObjectType::Tag);
-		types.push_back(ObjectType::GenericSql);
-		types.push_back(ObjectType::Textbox);
-		types.push_back(ObjectType::Relationship);
-		types.erase(std::find(types.begin(), types.end(), ObjectType::Schema));
+		QTreeWidgetItem *root = objectstree_tw->topLevelItem(0);
+		std::vector<BaseObject *> tree_state;
 
 		try
 		{
-			if(save_tree_state)
-				saveTreeState(tree_state);
-
-			objectstree_tw->clear();
-
-			if(visible_objs_map[ObjectType::Database])
+			/* If the tree already represents the current model its items are updated in place,
+			 * otherwise, the tree is recreated and only the first level of objects is created */
+			if(root && reinterpret_cast<BaseObject *>(root->data(0, Qt::UserRole).value<void *>()) == db_model)
+			{
+				configureItem(root, db_model);
+				updateChildItems(root);
+			}
+			else
 			{
+				if(save_tree_state)
+					saveTreeState(tree_state);
+
+				objectstree_tw->clear();
 				root=createItemForObject(db_model);
 				objectstree_tw->insertTopLevelItem(0,root);
-
-				updateSchemaTree(root);
-
-				for(auto &type : types)
-				{
-					if(visible_objs_map[type])
-					{
-						item1 = new QTreeWidgetItem(root);
-						str_aux=QString(BaseObject::getSchemaName(type));
-
-						item1->setIcon(0,QPixmap(GuiUtilsNs::getIconPath(str_aux)));
-						item1->setData(1, Qt::UserRole, QVariant(enum_t(type)));
-
-						obj_list=(*db_model->getObjectList(type));
-
-						//Special case for relationship, merging the base relationship list to the relationship list
-						if(type==ObjectType::Relationship)
-						{
-							std::vector<BaseObject *> obj_list_aux;
-							obj_list_aux=(*db_model->getObjectList(ObjectType::BaseRelationship));
-							obj_list.insert(obj_list.end(), obj_list_aux.begin(), obj_list_aux.end());
-						}
-
-						count=obj_list.size();
-						item1->setText(0,BaseObject::getTypeName(type) + QString(" (%1)").arg(count));
-						font=item1->font(0);
-						font.setItalic(true);
-						item1->setFont(0, font);
-
-						for(i1=0; i1 < count; i1++)
-						{
-							object=obj_list.at(i1);
-							item2=createItemForObject(object, item1);
-
-							if(types[i]==ObjectType::Tag)
-							{
-								db_model->getObjectReferences(object, ref_list);
-
-								for(auto &ref : ref_list)
-									createItemForObject(ref, item2, false);
-							}
-						}
-					}
-				}
-
+				updateChildItems(root);
 				objectstree_tw->expandItem(root);
 
 				if(save_tree_state)
@@ -1054,43 +1073,82 @@ void ModelObjectsWidget::restoreTreeState(std::vector<BaseObject *> &tree_items)
 
 QTreeWidgetItem *ModelObjectsWidget::getTreeItem(BaseObject *object)
 {
-	if(object)
-	{
-		QTreeWidgetItemIterator itr(objectstree_tw);
-		BaseObject *aux_obj=nullptr;
-		QTreeWidgetItem *item=nullptr;
+	QTreeWidgetItem *root = objectstree_tw->topLevelItem(0),
+			*parent_item = nullptr, *group_item = nullptr;
+	TableObject *tab_obj = dynamic_cast<TableObject *>(object);
+	BaseObject *parent = nullptr;
 
-		while(*itr)
-		{
-			aux_obj=reinterpret_cast<BaseObject *>((*itr)->data(0,Qt::UserRole).value<void *>());
+	if(!object || !db_model || !root)
+		return nullptr;
 
-			if(aux_obj==object)
-			{
-				item=*itr;
-				break;
-			}
+	if(object == db_model)
+		return root;
 
-			++itr;
-		}
-
-		return item;
-	}
+	/* Determining the object that owns the item in the tree so we can create
+	 * its child items (if not created yet) in order to locate the item of the object */
+	if(tab_obj)
+		parent = tab_obj->getParentTable();
+	else if(object->getSchema())
+		parent = object->getSchema();
 	else
+		parent = db_model;
+
+	parent_item = getTreeItem(parent);
+
+	if(!parent_item)
 		return nullptr;
+
+	if(!parent_item->data(0, PopulatedRole).toBool())
+		populateTreeItem(parent_item);
+
+	//The object items are always placed in a group item of the parent object item
+	for(int grp_idx = 0; grp_idx < parent_item->childCount(); grp_idx++)
+	{
+		group_item = parent_item->child(grp_idx);
+
+		if(!group_item->data(0, GroupTypeRole).isValid())
+			continue;
+
+		for(int idx = 0; idx < group_item->childCount(); idx++)
+		{
+			if(group_item->child(idx)->data(0, Qt::UserRole).value<void *>() == object)
+				return group_item->child(idx);
+		}
+	}
+
+	return nullptr;
 }
 
 void ModelObjectsWidget::selectCreatedObject(BaseObject *obj)
 {
+	selectCreatedObjects({ obj });
+}
+
+void ModelObjectsWidget::selectCreatedObjects(const std::vector<BaseObject *> &objs)
+{
+	QTreeWidgetItem *item = nullptr, *last_item = nullptr;
+
+	//The tree is updated only once for the whole set of created objects
 	updateObjectsView();
-	QTreeWidgetItem *item = getTreeItem(obj);
+	objectstree_tw->blockSignals(true);
 
-	if(item)
+	for(auto &obj : objs)
 	{
-		objectstree_tw->blockSignals(true);
-		item->setSelected(true);
-		objectstree_tw->setCurrentItem(item);
-		objectstree_tw->scrollToItem(item);
+		item = getTreeItem(obj);
+
+		if(item)
+		{
+			item->setSelected(true);
+			objectstree_tw->setCurrentItem(item);
+			last_item = item;
+		}
+	}
+
+	if(last_item)
+	{
+		objectstree_tw->scrollToItem(last_item);
 		select_tb->setFocus();
-		objectstree_tw->blockSignals(false);
 	}
+
+	objectstree_tw->blockSignals(false);
 }
@@ -67,32 +67,61 @@ class __libgui ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget
 
 		ObjectTypesListWidget *obj_types_wgt;
 
-		//! \brief Updates only a schema tree starting from the 'root' item
-		void updateSchemaTree(QTreeWidgetItem *root);
+		/*! \brief Item data role (column 0) that stores the object type of a group item, e.g., "Columns (n)".
+		 * This is used to locate the group items when updating the child items of an object */
+		static constexpr int GroupTypeRole = Qt::UserRole + 1,
 
-		/*! \brief Updates only a table / foreign table tree starting from the 'root' item.
-		 * table_type must be ObjectType::Table or ObjectType::ForeignTable */
-		void updateTableTree(QTreeWidgetItem *root, BaseObject *schema, ObjectType table_type);
+		/*! \brief Item data role (column 0) that indicates if the child items of an object item were already created.
+		 * The children of an object item are created only when it is expanded for the first time */
+		PopulatedRole = Qt::UserRole + 2;
 
-		//! \brief Updates only a view tree starting from the 'root' item
-		void updateViewTree(QTreeWidgetItem *root, BaseObject *schema);
+		/*! \brief Returns the (visible) types of the groups created under the item of the provided object.
+		 * For instance, for a table this method returns column, constraint, trigger, etc */
+		std::vector<ObjectType> getChildGroupTypes(BaseObject *object);
+
+		//! \brief Returns the objects of the specified type that are children of the parent object in the tree
+		std::vector<BaseObject *> getChildObjects(BaseObject *parent, ObjectType obj_type);
+
+		//! \brief Returns if the item of the provided object has child items (groups, permissions or references)
+		bool hasChildItems(BaseObject *object);
+
+		//! \brief Creates a group item, e.g., "Tables (n)", for the specified object type
+		QTreeWidgetItem *createGroupItem(ObjectType obj_type, QTreeWidgetItem *root);
+
+		/*! \brief Syncs the child items of 'root' with the provided object list by creating the items of new objects,
+		 * updating the items of the existing ones and destroying the items of objects that aren't in the list anymore */
+		void updateObjectItems(QTreeWidgetItem *root, const std::vector<BaseObject *> &obj_list, bool has_children);
+
+		/*! \brief Creates or updates the child items (groups and permissions) of the provided object item.
+		 * This method recursively updates only the items that were already populated */
+		void updateChildItems(QTreeWidgetItem *item);
+
+		//! \brief Creates all the items not created yet in the tree (used by the filtering and "expand all")
+		void populateAllTreeItems();
 
 		//! \brief Updates only the permission tree related to the specified object
 		void updatePermissionTree(QTreeWidgetItem *root, BaseObject *object);
 
-		//! \brief Updates the whole database object tree
+		/*! \brief Updates the database object tree. If the tree already represents the current model
+		 * only the items already created are updated, otherwise, the tree is recreated */
 		void updateDatabaseTree();
 
 		//! \brief Updates the whole object list
 		void updateObjectsList();
 
-		//! \brief Returns an item from the tree related to the specified object reference
+		/*! \brief Returns an item from the tree related to the specified object reference.
+		 * The items of the parent objects are populated when needed to reach the object's item */
 		QTreeWidgetItem *getTreeItem(BaseObject *object);
 
 		//! \brief Generates a QVariant containing the passed object reference as data
 		QVariant generateItemValue(BaseObject *object);
 
-		QTreeWidgetItem *createItemForObject(BaseObject *object, QTreeWidgetItem *root=nullptr, bool update_perms=true);
+		/*! \brief Creates an item for the provided object. When has_children is true the child items
+		 * of the object are created only when the item is expanded (see populateTreeItem()) */
+		QTreeWidgetItem *createItemForObject(BaseObject *object, QTreeWidgetItem *root=nullptr, bool has_children=true);
+
+		//! \brief Configures the text, font and icon of an item according to the provided object
+		void configureItem(QTreeWidgetItem *item, BaseObject *object);
 
 		void mouseMoveEvent(QMouseEvent *);
 		void resizeEvent(QResizeEvent *);
@@ -138,6 +167,12 @@ class __libgui ModelObjectsWidget: public QWidget, public Ui::ModelObjectsWidget
 		void filterObjects();
 		void selectCreatedObject(BaseObject *obj);
 
+		//! \brief Creates the child items of an object item when it is expanded for the first time
+		void populateTreeItem(QTreeWidgetItem *item);
+
+		//! \brief Selects in the tree the objects created in a single batch updating the tree only once
+		void selectCreatedObjects(const std::vector<BaseObject *> &objs);
+
 	signals:
 		void s_visibilityChanged(BaseObject *,bool);
 		void s_visibilityChanged(bool);
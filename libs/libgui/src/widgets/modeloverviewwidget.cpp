@@ -26,6 +26,7 @@ ModelOverviewWidget::ModelOverviewWidget(QWidget *parent) : QWidget(parent, Qt::
 	this->model=nullptr;
 	zoom_factor=1;
 	curr_resize_factor=ResizeFactor;
+	full_update=check_items=false;
 	this->setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Fixed);
 
 	QVBoxLayout *vbox = new QVBoxLayout;
@@ -38,6 +39,10 @@ ModelOverviewWidget::ModelOverviewWidget(QWidget *parent) : QWidget(parent, Qt::
 	vbox->setContentsMargins(0,0,0,0);
 	frame->setLayout(vbox);
 	label->setStyleSheet("QLabel#label{ border: 0px; }");
+
+	update_timer.setSingleShot(true);
+	update_timer.setInterval(UpdateInterval);
+	connect(&update_timer, &QTimer::timeout, this, &ModelOverviewWidget::updateDirtyRegions);
 }
 
 void ModelOverviewWidget::show(ModelWidget *model)
@@ -49,13 +54,20 @@ void ModelOverviewWidget::show(ModelWidget *model)
 		disconnect(this->model->scene, nullptr,  this, nullptr);
 	}
 
+	update_timer.stop();
+	dirty_rects.clear();
+	items_states.clear();
+	full_update=check_items=false;
 	this->model=model;
 
 	if(this->model)
 	{
-		connect(this->model, &ModelWidget::s_objectCreated, this, qOverload<>(&ModelOverviewWidget::updateOverview));
-		connect(this->model, &ModelWidget::s_objectRemoved, this, qOverload<>(&ModelOverviewWidget::updateOverview));
-		connect(this->model, &ModelWidget::s_objectsMoved, this, qOverload<>(&ModelOverviewWidget::updateOverview));
+		/* Instead of rendering the whole scene on each change we only check the regions of the
+		 * objects created, removed, moved or selected and redraw them in the cached overview image.
+		 * Modifications that don't change the objects' geometry (e.g. colors) force a full update */
+		connect(this->model, &ModelWidget::s_objectCreated, this, &ModelOverviewWidget::scheduleItemsCheck);
+		connect(this->model, &ModelWidget::s_objectRemoved, this, &ModelOverviewWidget::scheduleItemsCheck);
+		connect(this->model, &ModelWidget::s_objectsMoved, this, &ModelOverviewWidget::scheduleItemsCheck);
 		connect(this->model, &ModelWidget::s_objectModified, this, qOverload<>(&ModelOverviewWidget::updateOverview));
 		connect(this->model, &ModelWidget::s_zoomModified, this, &ModelOverviewWidget::updateZoomFactor);
 		connect(this->model, &ModelWidget::s_modelResized, this, &ModelOverviewWidget::resizeOverview);
@@ -65,7 +77,9 @@ void ModelOverviewWidget::show(ModelWidget *model)
 		connect(this->model->viewport->horizontalScrollBar(), &QScrollBar::valueChanged, this, &ModelOverviewWidget::resizeWindowFrame);
 		connect(this->model->viewport->verticalScrollBar(), &QScrollBar::valueChanged, this, &ModelOverviewWidget::resizeWindowFrame);
 
-		connect(this->model->scene, &ObjectsScene::selectionChanged, this, qOverload<>(&ModelOverviewWidget::updateOverview));
+		connect(this->model->scene, &ObjectsScene::selectionChanged, this, &ModelOverviewWidget::scheduleItemsCheck);
+		connect(this->model->scene, &ObjectsScene::s_objectsMoved, this, &ModelOverviewWidget::scheduleItemsCheck);
+		connect(this->model->scene, &ObjectsScene::s_objectModified, this, &ModelOverviewWidget::scheduleItemsCheck);
 		connect(this->model->scene, &ObjectsScene::sceneRectChanged,this, &ModelOverviewWidget::resizeOverview);
 		connect(this->model->scene, &ObjectsScene::sceneRectChanged,this, qOverload<>(&ModelOverviewWidget::updateOverview));
 
@@ -85,6 +99,17 @@ void ModelOverviewWidget::show(ModelWidget *model)
 
 void ModelOverviewWidget::closeEvent(QCloseEvent *event)
 {
+	if(model)
+	{
+		disconnect(model, nullptr, this, nullptr);
+		disconnect(model->viewport, nullptr,  this, nullptr);
+		disconnect(model->scene, nullptr,  this, nullptr);
+	}
+
+	update_timer.stop();
+	dirty_rects.clear();
+	items_states.clear();
+	full_update=check_items=false;
 	model=nullptr;
 	emit s_overviewVisible(false);
 	QWidget::closeEvent(event);
@@ -116,45 +141,193 @@ bool ModelOverviewWidget::eventFilter(QObject *object, QEvent *event)
 
 void ModelOverviewWidget::updateOverview()
 {
-	this->updateOverview(false);
+	if(!this->model || !this->isVisible())
+		return;
+
+	full_update=true;
+	dirty_rects.clear();
+
+	if(!update_timer.isActive())
+		update_timer.start();
 }
 
 void ModelOverviewWidget::updateOverview(bool force_update)
 {
 	if(this->model && (this->isVisible() || force_update))
 	{
-		QPixmap pix;
-
-		qApp->setOverrideCursor(Qt::WaitCursor);
+		QSize img_size = (curr_size * this->devicePixelRatioF()).toSize();
 
-		//Creates a pixmap with the size of the scene
-		pix = QPixmap(pixmap_size);
-		pix.fill(ObjectsScene::getCanvasColor());
+		update_timer.stop();
+		dirty_rects.clear();
+		full_update=check_items=false;
 
-		//Draw the scene onto the pixmap
-		QPainter p(&pix);
+		/* The overview image is created in the same size (in device pixels) it'll be displayed
+		 * instead of the scene size, avoiding the rendering of the whole scene in full resolution */
+		overview_img = QImage(img_size, QImage::Format_ARGB32_Premultiplied);
 
-		if(!p.isActive())
+		if(overview_img.isNull())
 		{
 			label->setPixmap(QPixmap());
 			label->setText(tr("Failed to generate the overview image.\nThe requested size %1 x %2 was too big and there was not enough memory to allocate!")
-										 .arg(pixmap_size.width()).arg(pixmap_size.height()));
+										 .arg(img_size.width()).arg(img_size.height()));
 			frame->setEnabled(false);
 		}
 		else
 		{
 			frame->setEnabled(true);
+			renderOverviewRects({ scene_rect });
+			updateItemsStates(true);
+		}
 
-			p.setRenderHints(QPainter::Antialiasing, false);
-			p.setRenderHints(QPainter::TextAntialiasing, false);
-			this->model->scene->render(&p, QRect(), scene_rect);
+		label->resize(curr_size.toSize());
+	}
+}
+
+void ModelOverviewWidget::renderOverviewRects(const QList<QRectF> &rects)
+{
+	if(!this->model || overview_img.isNull() ||
+		 scene_rect.width() <= 0 || scene_rect.height() <= 0)
+		return;
 
-			//Resizes the pixmap to the previous configured QSize
-			label->setPixmap(pix);
+	QPainter painter(&overview_img);
+	QRect tgt_rect;
+	QRectF src_rect;
+	double factor_x = overview_img.width() / scene_rect.width(),
+			factor_y = overview_img.height() / scene_rect.height();
+
+	painter.setRenderHint(QPainter::Antialiasing, false);
+	painter.setRenderHint(QPainter::TextAntialiasing, false);
+
+	for(auto &rect : rects)
+	{
+		/* Aligning the changed region to the image pixels so the portion of the scene rendered
+		 * matches exactly the area replaced in the cached image (avoiding seams between regions) */
+		tgt_rect = QRectF((rect.x() - scene_rect.x()) * factor_x, (rect.y() - scene_rect.y()) * factor_y,
+											rect.width() * factor_x, rect.height() * factor_y).toAlignedRect().intersected(overview_img.rect());
+
+		if(tgt_rect.isEmpty())
+			continue;
+
+		src_rect = QRectF(scene_rect.x() + (tgt_rect.x() / factor_x), scene_rect.y() + (tgt_rect.y() / factor_y),
+											tgt_rect.width() / factor_x, tgt_rect.height() / factor_y);
+
+		painter.save();
+		painter.setClipRect(tgt_rect);
+		painter.fillRect(tgt_rect, ObjectsScene::getCanvasColor());
+		this->model->scene->render(&painter, tgt_rect, src_rect, Qt::IgnoreAspectRatio);
+		painter.restore();
+	}
+
+	painter.end();
+	label->setPixmap(QPixmap::fromImage(overview_img));
+}
+
+void ModelOverviewWidget::updateItemsStates(bool store_only)
+{
+	std::map<unsigned, ItemState> curr_states;
+	BaseObjectView *obj_view=nullptr;
+	ItemState state;
+
+	if(!this->model)
+		return;
+
+	for(auto &item : this->model->scene->items())
+	{
+		obj_view=dynamic_cast<BaseObjectView *>(item);
+
+		// Only the top level objects' views are checked since their bounding rects include their children
+		if(!obj_view || item->parentItem() || !obj_view->getUnderlyingObject())
+			continue;
+
+		state.rect=item->sceneBoundingRect();
+		state.selected=item->isSelected();
+		state.visible=item->isVisible();
+		curr_states[obj_view->getUnderlyingObject()->getObjectId()]=state;
+	}
+
+	if(!store_only)
+	{
+		for(auto &itr : curr_states)
+		{
+			auto old_itr=items_states.find(itr.first);
+
+			// Created objects or the ones in which the geometry, selection or visibility changed
+			if(old_itr==items_states.end() ||
+				 old_itr->second.rect!=itr.second.rect ||
+				 old_itr->second.selected!=itr.second.selected ||
+				 old_itr->second.visible!=itr.second.visible)
+			{
+				dirty_rects.append(itr.second.rect);
+
+				if(old_itr!=items_states.end())
+					dirty_rects.append(old_itr->second.rect);
+			}
+
+			if(old_itr!=items_states.end())
+				items_states.erase(old_itr);
 		}
 
-		label->resize(curr_size.toSize());
-		qApp->restoreOverrideCursor();
+		// The remaining states are from removed objects
+		for(auto &itr : items_states)
+			dirty_rects.append(itr.second.rect);
+
+		dirty_rects.removeIf([](const QRectF &rect){
+			return rect.isEmpty();
+		});
+
+		if(dirty_rects.size() > MaxDirtyRects)
+		{
+			QRectF brect;
+
+			for(auto &rect : dirty_rects)
+				brect = brect.united(rect);
+
+			dirty_rects = { brect };
+		}
+	}
+
+	items_states.swap(curr_states);
+}
+
+void ModelOverviewWidget::scheduleItemsCheck()
+{
+	if(!this->model || !this->isVisible())
+		return;
+
+	check_items=true;
+
+	/* The timer is not restarted when it's already running so the overview is still
+	 * refreshed periodically during long operations like objects dragging */
+	if(!update_timer.isActive())
+		update_timer.start();
+}
+
+void ModelOverviewWidget::updateDirtyRegions()
+{
+	if(!this->model || !this->isVisible())
+	{
+		dirty_rects.clear();
+		full_update=check_items=false;
+		return;
+	}
+
+	if(full_update)
+		updateOverview(false);
+	else
+	{
+		QList<QRectF> rects;
+
+		if(check_items)
+		{
+			check_items=false;
+			updateItemsStates(false);
+		}
+
+		if(!dirty_rects.isEmpty())
+		{
+			rects.swap(dirty_rects);
+			renderOverviewRects(rects);
+		}
 	}
 }
 
@@ -212,26 +385,16 @@ void ModelOverviewWidget::resizeOverview()
 
 			//Reduce the resize factor and recalculates the new size
 			if(max_val >= 16384)
-			{
 				curr_resize_factor=screen_rect.width()/static_cast<double>(max_val);
-				pixmap_size.setWidth(scene_rect.size().width() * (curr_resize_factor * 10));
-				pixmap_size.setHeight(scene_rect.size().height() * (curr_resize_factor * 10));
-			}
 			else
-			{
 				curr_resize_factor=ResizeFactor/2;
-				pixmap_size=scene_rect.size().toSize();
-			}
 
 			curr_size=scene_rect.size();
 			curr_size.setWidth(curr_size.width() * curr_resize_factor);
 			curr_size.setHeight(curr_size.height() * curr_resize_factor);
 		}
 		else
-		{
 			curr_resize_factor=ResizeFactor;
-			pixmap_size=scene_rect.size().toSize();
-		}
 
 		QSize size = curr_size.toSize();
 		bool show_scrollarea = false;
@@ -51,11 +51,42 @@ class __libgui ModelOverviewWidget: public QWidget, public Ui::ModelOverviewWidg
 		//! \brief Current scene rectangle
 		QRectF scene_rect;
 
-		QSize pixmap_size;
+		//! \brief Cached low resolution rendering of the scene which is updated only in the changed regions
+		QImage overview_img;
+
+		//! \brief Scene regions changed since the last overview update
+		QList<QRectF> dirty_rects;
+
+		//! \brief Stores the graphical state of an object's view when it was rendered in the overview
+		struct ItemState {
+			QRectF rect;
+			bool selected, visible;
+		};
+
+		/*! \brief Graphical states of the objects' views (indexed by the objects' ids) rendered in the cached image.
+		 * These are compared to the current ones to determine the regions to be redrawn */
+		std::map<unsigned, ItemState> items_states;
+
+		//! \brief Indicates that the whole cached image must be rendered again in the next update
+		bool full_update,
+
+		//! \brief Indicates that the objects' views must be checked for changes in the next update
+		check_items;
+
+		//! \brief Timer used to throttle the overview updates while the scene is being changed
+		QTimer update_timer;
 
 		//! \brief Resize factor applied to overview widgets (default: 20% of the scene original size)
 		static constexpr double ResizeFactor = 0.20;
 
+		/*! \brief Minimum interval (in ms) between two overview updates. Scene changes that happen
+		 *  in this interval are accumulated and rendered at once */
+		static constexpr int UpdateInterval = 250;
+
+		/*! \brief Maximum amount of dirty rects stored. When this limit is reached the dirty rects
+		 *  are merged into a single one to avoid rendering overlapping regions several times */
+		static constexpr int MaxDirtyRects = 32;
+
 		void mouseDoubleClickEvent(QMouseEvent *);
 		void mousePressEvent(QMouseEvent *event);
 		void mouseReleaseEvent(QMouseEvent *event);
@@ -64,15 +95,33 @@ class __libgui ModelOverviewWidget: public QWidget, public Ui::ModelOverviewWidg
 		void showEvent(QShowEvent *event);
 		bool eventFilter(QObject *object, QEvent *event);
 
-		/*! \brief Updates the overview with the last modifications on the scene. The bool parameter
+		/*! \brief Renders the whole scene in the cached overview image. The bool parameter
 		is used to force the update even if the overview widget is not visible */
 		void updateOverview(bool force_update);
 
+		/*! \brief Renders the provided scene rectangles onto the cached overview image
+		 *  reusing the areas that were not changed */
+		void renderOverviewRects(const QList<QRectF> &rects);
+
+		/*! \brief Compares the current graphical state of the objects' views to the ones stored in items_states
+		 *  storing the old and new regions of the changed, created and removed objects in dirty_rects.
+		 *  When store_only is true the current states are only stored without generating dirty regions */
+		void updateItemsStates(bool store_only);
+
+	private slots:
+		/*! \brief Schedules the overview update checking which objects' views were changed (created, removed,
+		 *  moved, selected, etc). This is used in place of QGraphicsScene::changed() because connecting to that
+		 *  signal disables the direct item-to-view updates of the main canvas */
+		void scheduleItemsCheck();
+
+		//! \brief Renders the pending dirty regions (or the whole scene if needed) in the overview
+		void updateDirtyRegions();
+
 	public:
 		ModelOverviewWidget(QWidget *parent = nullptr);
 
 	public slots:
-		//! \brief Updates the overview (only if the widget is visible)
+		//! \brief Schedules a full update of the overview (only if the widget is visible)
 		void updateOverview();
 
 		//! \brief Resizes the frame that represents the visualization window
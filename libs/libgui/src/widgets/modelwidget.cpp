@@ -93,6 +93,8 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 
 	current_zoom = 1;
 	modified = panning_mode = wheel_move = false;
+	defer_views_creation = false;
+	next_deferred_idx = 0;
 	curr_show_grid = curr_show_delim = true;
 	new_obj_type = ObjectType::BaseObject;
 
@@ -559,6 +561,7 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 	connect(action_hide_schemas_rects, &QAction::triggered, this, &ModelWidget::toggleSchemasRectangles);
 
 	connect(db_model, &DatabaseModel::s_objectAdded, this, &ModelWidget::handleObjectAddition);
+	connect(db_model, &DatabaseModel::s_objectsAdded, this, &ModelWidget::handleObjectsAddition);
 	connect(db_model, &DatabaseModel::s_objectRemoved, this, &ModelWidget::handleObjectRemoval);
 
 	connect(scene, &ObjectsScene::s_objectsMoved, this, &ModelWidget::handleObjectsMovement);
@@ -604,21 +607,29 @@ ModelWidget::ModelWidget(QWidget *parent) : QWidget(parent)
 		wheel_move = false;
 	});
 
+	deferred_views_timer.setInterval(0);
+	deferred_views_timer.setSingleShot(true);
+	connect(&deferred_views_timer, &QTimer::timeout, this, &ModelWidget::createNextDeferredViews);
+
 	viewport->installEventFilter(this);
 	viewport->horizontalScrollBar()->installEventFilter(this);
 	viewport->verticalScrollBar()->installEventFilter(this);
 
 	connect(viewport->verticalScrollBar(), &QScrollBar::valueChanged, this, [this]() {
 		viewport->resetCachedContent();
+		createVisibleDeferredViews();
 	});
 
 	connect(viewport->horizontalScrollBar(), &QScrollBar::valueChanged, this, [this]() {
 		viewport->resetCachedContent();
+		createVisibleDeferredViews();
 	});
 }
 
 ModelWidget::~ModelWidget()
 {
+	deferred_views_timer.stop();
+
 	/* If there are copied/cutted objects that belongs to the database model
 	 being destroyed, then the cut/copy operation are cancelled by emptying
 	 the lists, avoiding crashes when trying to paste them */
@@ -901,6 +912,8 @@ void ModelWidget::applyZoom(double zoom)
 	viewport->resetTransform();
 	viewport->scale(zoom, zoom);
 	this->current_zoom=zoom;
+	scene->setLevelOfDetail(BaseObjectView::getLevelOfDetail(zoom));
+	createVisibleDeferredViews();
 
 	zoom_info_lbl->setText(tr("Zoom: %1%").arg(QString::number(this->current_zoom * 100, 'g' , 3)));
 	zoom_info_lbl->setVisible(true);
@@ -917,50 +930,245 @@ double ModelWidget::getCurrentZoom()
 	return current_zoom;
 }
 
+QGraphicsItem *ModelWidget::createObjectView(BaseGraphicObject *graph_obj)
+{
+	if(!graph_obj)
+		return nullptr;
+
+	ObjectType obj_type=graph_obj->getObjectType();
+	QGraphicsItem *item=nullptr;
+
+	switch(obj_type)
+	{
+		case ObjectType::ForeignTable:
+		case ObjectType::Table:
+			item=new TableView(dynamic_cast<PhysicalTable *>(graph_obj));
+		break;
+
+		case ObjectType::View:
+			item=new GraphicalView(dynamic_cast<View *>(graph_obj));
+		break;
+
+		case ObjectType::Relationship:
+		case ObjectType::BaseRelationship:
+			item=new RelationshipView(dynamic_cast<BaseRelationship *>(graph_obj));
+		break;
+
+		case ObjectType::Schema:
+			if(!graph_obj->isSystemObject() ||
+					(graph_obj->isSystemObject() && graph_obj->getName()=="public"))
+			{
+				item=new SchemaView(dynamic_cast<Schema *>(graph_obj));
+			}
+		break;
+
+		default:
+			item=new StyledTextboxView(dynamic_cast<Textbox *>(graph_obj));
+		break;
+	}
+
+	if(item)
+		scene->addItem(item);
+
+	return item;
+}
+
 void ModelWidget::handleObjectAddition(BaseObject *object)
 {
-	BaseGraphicObject *graph_obj=dynamic_cast<BaseGraphicObject *>(object);
+	handleObjectsAddition({ object });
+}
 
-	if(graph_obj)
+void ModelWidget::handleObjectsAddition(const std::vector<BaseObject *> &objects)
+{
+	BaseGraphicObject *graph_obj=nullptr;
+	bool views_created=false;
+
+	for(auto &object : objects)
 	{
-		ObjectType obj_type=graph_obj->getObjectType();
-		QGraphicsItem *item=nullptr;
+		graph_obj=dynamic_cast<BaseGraphicObject *>(object);
 
-		switch(obj_type)
+		if(!graph_obj)
+			continue;
+
+		/* While loading a model the views aren't created right away. Instead, the object is
+		 * marked as deferred and its view is created later, when it becomes visible, when
+		 * it's requested via getOverlyingObject() or by the background creation */
+		if(defer_views_creation)
 		{
-			case ObjectType::ForeignTable:
-			case ObjectType::Table:
-				item=new TableView(dynamic_cast<PhysicalTable *>(graph_obj));
-			break;
+			graph_obj->setOverlyingObjectDeferred(true);
+			connect(graph_obj, &BaseGraphicObject::s_overlyingObjectRequested, this, &ModelWidget::createDeferredView);
+			deferred_objs.push_back(graph_obj);
+		}
+		else if(createObjectView(graph_obj))
+			views_created=true;
+	}
 
-			case ObjectType::View:
-				item=new GraphicalView(dynamic_cast<View *>(graph_obj));
-			break;
+	if(views_created)
+		setModified(true);
+}
 
-			case ObjectType::Relationship:
-			case ObjectType::BaseRelationship:
-				item=new RelationshipView(dynamic_cast<BaseRelationship *>(graph_obj));
-			break;
+void ModelWidget::createDeferredView(BaseGraphicObject *graph_obj)
+{
+	if(!graph_obj)
+		return;
 
-			case ObjectType::Schema:
-				if(!graph_obj->isSystemObject() ||
-						(graph_obj->isSystemObject() && graph_obj->getName()=="public"))
-				{
-					item=new SchemaView(dynamic_cast<Schema *>(graph_obj));
-				}
-			break;
+	BaseObjectView *obj_view=nullptr;
 
-			default:
-				item=new StyledTextboxView(dynamic_cast<Textbox *>(graph_obj));
-			break;
+	disconnect(graph_obj, &BaseGraphicObject::s_overlyingObjectRequested, this, &ModelWidget::createDeferredView);
+	graph_obj->setOverlyingObjectDeferred(false);
+	obj_view=dynamic_cast<BaseObjectView *>(createObjectView(graph_obj));
+
+	if(!obj_view)
+		return;
+
+	/* Since the deferred views don't exist when the objects are aligned to the grid
+	 * after loading the model we need to align them individually */
+	if(ObjectsScene::isAlignObjectsToGrid())
+		scene->alignItemToGrid(obj_view);
+
+	if(graph_obj->isFadedOut())
+	{
+		obj_view->setOpacity(min_object_opacity);
+		obj_view->setVisible(min_object_opacity > 0);
+	}
+}
+
+void ModelWidget::createDeferredViews(const QRectF &rect)
+{
+	BaseRelationship *rel=nullptr;
+	ObjectType obj_type;
+
+	for(auto &graph_obj : deferred_objs)
+	{
+		if(!graph_obj->isOverlyingObjectDeferred())
+			continue;
+
+		obj_type=graph_obj->getObjectType();
+
+		if(obj_type==ObjectType::Schema)
+			continue;
+
+		if(obj_type==ObjectType::Relationship || obj_type==ObjectType::BaseRelationship)
+		{
+			rel=dynamic_cast<BaseRelationship *>(graph_obj);
+
+			if(!rel->getTable(BaseRelationship::SrcTable)->isOverlyingObjectDeferred() &&
+				 !rel->getTable(BaseRelationship::DstTable)->isOverlyingObjectDeferred())
+				createDeferredView(graph_obj);
 		}
+		else if(rect.contains(graph_obj->getPosition()))
+			createDeferredView(graph_obj);
+	}
+}
 
-		if(item)
+void ModelWidget::createDeferredViews()
+{
+	if(deferred_objs.empty())
+		return;
+
+	deferred_views_timer.stop();
+
+	for(auto &graph_obj : deferred_objs)
+	{
+		if(graph_obj->isOverlyingObjectDeferred())
+			createDeferredView(graph_obj);
+	}
+
+	finishDeferredViewsCreation();
+}
+
+void ModelWidget::createVisibleDeferredViews()
+{
+	if(deferred_objs.empty() || defer_views_creation)
+		return;
+
+	QRectF rect=viewport->mapToScene(viewport->viewport()->rect()).boundingRect();
+
+	//Including the objects a bit beyond the visible area so they are ready for small scroll movements
+	rect.adjust(-rect.width()/2, -rect.height()/2, rect.width()/2, rect.height()/2);
+	createDeferredViews(rect);
+}
+
+void ModelWidget::createNextDeferredViews()
+{
+	BaseGraphicObject *graph_obj=nullptr;
+	unsigned count=0;
+
+	while(next_deferred_idx < deferred_objs.size() && count < DeferredViewsBatch)
+	{
+		graph_obj=deferred_objs[next_deferred_idx++];
+
+		if(graph_obj->isOverlyingObjectDeferred())
 		{
-			scene->addItem(item);
-			setModified(true);
+			createDeferredView(graph_obj);
+			count++;
 		}
 	}
+
+	if(next_deferred_idx < deferred_objs.size())
+		deferred_views_timer.start();
+	else
+		finishDeferredViewsCreation();
+}
+
+void ModelWidget::startDeferredViewsCreation()
+{
+	defer_views_creation=false;
+
+	if(deferred_objs.empty())
+		return;
+
+	/* The views are created in the following order: tables, views and textboxes first, then
+	 * relationships (which depend on the tables) and lastly schemas (which depend on all their children) */
+	auto priority = [](BaseGraphicObject *obj) {
+		ObjectType obj_type=obj->getObjectType();
+
+		if(obj_type==ObjectType::Schema)
+			return 2;
+
+		if(obj_type==ObjectType::Relationship || obj_type==ObjectType::BaseRelationship)
+			return 1;
+
+		return 0;
+	};
+
+	std::stable_sort(deferred_objs.begin(), deferred_objs.end(), [&priority](BaseGraphicObject *obj1, BaseGraphicObject *obj2) {
+		return priority(obj1) < priority(obj2);
+	});
+
+	next_deferred_idx=0;
+	createVisibleDeferredViews();
+	deferred_views_timer.start();
+}
+
+void ModelWidget::finishDeferredViewsCreation()
+{
+	QRectF rect;
+	SchemaView *sch_view = nullptr;
+
+	deferred_views_timer.stop();
+	deferred_objs.clear();
+	next_deferred_idx=0;
+
+	/* Schemas compute their boxes only from the children views in the scene, so a schema view
+	 * created on demand before its children (e.g. when selected) needs to be reconfigured */
+	for(auto &obj : *db_model->getObjectList(ObjectType::Schema))
+	{
+		sch_view = dynamic_cast<SchemaView *>(dynamic_cast<Schema *>(obj)->getOverlyingObject());
+
+		if(sch_view)
+			sch_view->configureObject();
+	}
+
+	/* The scene size calculated after loading the model is based only on the deferred objects' positions,
+	 * so we expand the scene if the created views exceed that size */
+	rect=scene->itemsBoundingRect();
+	rect.setTopLeft(QPointF(0,0));
+	rect.setWidth(rect.width() + (2 * ObjectsScene::getGridSize()));
+	rect.setHeight(rect.height() + (2 * ObjectsScene::getGridSize()));
+
+	if(!scene->sceneRect().contains(rect))
+		scene->setSceneRect(scene->sceneRect().united(rect));
 }
 
 void ModelWidget::addNewObject()
@@ -1052,7 +1260,24 @@ void ModelWidget::handleObjectRemoval(BaseObject *object)
 
 	if(graph_obj)
 	{
-		scene->removeItem(dynamic_cast<QGraphicsItem *>(graph_obj->getOverlyingObject()));
+		//Objects which views were not created yet are only removed from the deferred objects list
+		if(graph_obj->isOverlyingObjectDeferred())
+		{
+			auto itr=std::find(deferred_objs.begin(), deferred_objs.end(), graph_obj);
+
+			if(itr!=deferred_objs.end())
+			{
+				if(static_cast<size_t>(itr - deferred_objs.begin()) < next_deferred_idx)
+					next_deferred_idx--;
+
+				deferred_objs.erase(itr);
+			}
+
+			disconnect(graph_obj, &BaseGraphicObject::s_overlyingObjectRequested, this, &ModelWidget::createDeferredView);
+			graph_obj->setOverlyingObjectDeferred(false);
+		}
+		else
+			scene->removeItem(dynamic_cast<QGraphicsItem *>(graph_obj->getOverlyingObject()));
 
 		//Updates the parent schema if the removed object were a table or view
 		if(graph_obj->getSchema() &&
@@ -1148,7 +1373,8 @@ void ModelWidget::handleObjectsMovement(bool end_moviment)
 
 void ModelWidget::handleObjectModification(BaseGraphicObject *object)
 {
-	op_list->registerObject(object, Operation::ObjModified);
+	//Only the relationship's line points are changed by the user here so the graphical attributes are enough to undo it
+	op_list->registerObject(object, Operation::ObjModified, -1, nullptr, Operation::GraphicDelta);
 	setModified(true);
 	emit s_objectModified();
 
@@ -1286,6 +1512,9 @@ void ModelWidget::selectAllObjects()
 	if(!act)
 		return;
 
+	//Scene-wide operations need all the objects' views, so the pending deferred ones are created first
+	createDeferredViews();
+
 	ObjectType obj_type = static_cast<ObjectType>(act->data().toUInt());
 
 	if(obj_type == ObjectType::BaseObject)
@@ -1715,11 +1944,13 @@ void ModelWidget::loadModel(const QString &filename)
 		task_prog_wgt.setWindowTitle(tr("Loading database model"));
 		task_prog_wgt.show();
 
-		db_model->loadModel(filename);		
+		defer_views_creation=true;
+		db_model->loadModel(filename);
 		this->filename=filename;
 		updateObjectsOpacity();
 		updateSceneLayers();
 		adjustSceneSize();
+		startDeferredViewsCreation();
 
 		task_prog_wgt.close();
 		protected_model_frm->setVisible(db_model->isProtected());
@@ -1728,6 +1959,7 @@ void ModelWidget::loadModel(const QString &filename)
 	catch(Exception &e)
 	{
 		task_prog_wgt.close();
+		startDeferredViewsCreation();
 		setModified(false);
 		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
 	}
@@ -1764,6 +1996,17 @@ void ModelWidget::adjustSceneSize()
 	}
 
 	QRectF rect = scene->itemsBoundingRect();
+
+	//Objects which views' creation were deferred have their positions used to estimate the scene size
+	for(auto &graph_obj : deferred_objs)
+	{
+		if(graph_obj->isOverlyingObjectDeferred() &&
+			 graph_obj->getObjectType()!=ObjectType::Relationship &&
+			 graph_obj->getObjectType()!=ObjectType::BaseRelationship &&
+			 graph_obj->getObjectType()!=ObjectType::Schema)
+			rect=rect.united(QRectF(graph_obj->getPosition(), QSizeF(1, 1)));
+	}
+
 	rect.setTopLeft(QPointF(0,0));
 	rect.setWidth(rect.width() + (2 * ObjectsScene::getGridSize()));
 	rect.setHeight(rect.height() + (2 * ObjectsScene::getGridSize()));
@@ -1786,6 +2029,9 @@ void ModelWidget::printModel(QPrinter *printer, bool print_grid, bool print_page
 	QColor color, bg_color;
 	QRectF brect;
 
+	//All the objects need to be in the scene to be printed
+	createDeferredViews();
+
 	//Make a backup of the current grid options
 	bg_color = ObjectsScene::getCanvasColor();
 	show_grid = ObjectsScene::isShowGrid();
@@ -1797,6 +2043,9 @@ void ModelWidget::printModel(QPrinter *printer, bool print_grid, bool print_page
 	ObjectsScene::setShowPageDelimiters(false);
 
 	scene->setShowSceneLimits(false);
+	scene->setLevelOfDetail(BaseObjectView::FullDetail);
+	scene->setObjectsCacheEnabled(false);
+	scene->updatePendingRelationships();
 	scene->update();
 	scene->clearSelection();
 
@@ -1854,6 +2103,8 @@ void ModelWidget::printModel(QPrinter *printer, bool print_grid, bool print_page
 	ObjectsScene::setShowGrid(show_grid);
 	ObjectsScene::setShowPageDelimiters(show_delims);
 	scene->setShowSceneLimits(true);
+	scene->setLevelOfDetail(BaseObjectView::getLevelOfDetail(current_zoom));
+	scene->setObjectsCacheEnabled(true);
 	scene->update();
 }
 
@@ -2979,75 +3230,89 @@ void ModelWidget::pasteObjects(bool duplicate_mode)
 
 	op_list->startOperationChain();
 
-	while(itr!=itr_end)
-	{
-		object = *itr;
-		itr++;
+	//The pasted objects are notified to the views at once at the end of the process
+	db_model->beginObjectsAddition();
 
-		if(xml_objs.count(object))
+	try
+	{
+		while(itr!=itr_end)
 		{
-			xmlparser->restartParser();
-			xmlparser->loadXMLBuffer(xml_objs[object]);
+			object = *itr;
+			itr++;
 
-			try
+			if(xml_objs.count(object))
 			{
-				pos++;
-				task_prog_wgt.updateProgress((pos/static_cast<double>(copied_objects.size()))*100,
-											 tr("Pasting object: `%1' (%2)").arg(object->getName())
-											 .arg(object->getTypeName()),
-											 enum_t(object->getObjectType()));
-
-				//Creates the object from the XML
-				object=db_model->createObject(BaseObject::getObjectType(xmlparser->getElementName()));
-				tab_obj=dynamic_cast<TableObject *>(object);
-				constr=dynamic_cast<Constraint *>(tab_obj);
-
-				/* Once created, the object is added on the model, except for relationships and table objects
-				 * because they are inserted automatically */
-				if(object && !tab_obj && !dynamic_cast<Relationship *>(object))
+				try
 				{
-					if(db_model->getObjectIndex(object->getSignature(), object->getObjectType()) >= 0)
-						object->setName(CoreUtilsNs::generateUniqueName(object, *db_model->getObjectList(object->getObjectType()), false, "_cp"));
+					xmlparser->restartParser();
+					xmlparser->loadXMLBuffer(xml_objs[object]);
 
-					db_model->addObject(object);
-				}
+					pos++;
+					task_prog_wgt.updateProgress((pos/static_cast<double>(copied_objects.size()))*100,
+												 tr("Pasting object: `%1' (%2)").arg(object->getName())
+												 .arg(object->getTypeName()),
+												 enum_t(object->getObjectType()));
 
-				//Special case for table objects
-				if(tab_obj)
-				{
-					if(sel_table && tab_obj->getObjectType()==ObjectType::Column)
+					//Creates the object from the XML
+					object=db_model->createObject(BaseObject::getObjectType(xmlparser->getElementName()));
+					tab_obj=dynamic_cast<TableObject *>(object);
+					constr=dynamic_cast<Constraint *>(tab_obj);
+
+					/* Once created, the object is added on the model, except for relationships and table objects
+					 * because they are inserted automatically */
+					if(object && !tab_obj && !dynamic_cast<Relationship *>(object))
 					{
-						sel_table->addObject(tab_obj);
-						sel_table->setModified(true);
+						if(db_model->getObjectIndex(object->getSignature(), object->getObjectType()) >= 0)
+							object->setName(CoreUtilsNs::generateUniqueName(object, *db_model->getObjectList(object->getObjectType()), false, "_cp"));
+
+						db_model->addObject(object);
 					}
-					else if(constr && duplicate_mode &&
-							constr->getConstraintType() == ConstraintType::PrimaryKey &&
-							constr->getParentTable()->getObjectIndex(constr) < 0)
+
+					//Special case for table objects
+					if(tab_obj)
 					{
-					  constr->getParentTable()->addObject(constr);
-					  constr->getParentTable()->setModified(true);
-					}
+						if(sel_table && tab_obj->getObjectType()==ObjectType::Column)
+						{
+							sel_table->addObject(tab_obj);
+							sel_table->setModified(true);
+						}
+						else if(constr && duplicate_mode &&
+								constr->getConstraintType() == ConstraintType::PrimaryKey &&
+								constr->getParentTable()->getObjectIndex(constr) < 0)
+						{
+						  constr->getParentTable()->addObject(constr);
+						  constr->getParentTable()->setModified(true);
+						}
 
-					//Updates the fk relationships if the constraint is a foreign-key
-					if(constr && constr->getConstraintType()==ConstraintType::ForeignKey)
-						db_model->updateTableFKRelationships(dynamic_cast<Table *>(tab_obj->getParentTable()));
+						//Updates the fk relationships if the constraint is a foreign-key
+						if(constr && constr->getConstraintType()==ConstraintType::ForeignKey)
+							db_model->updateTableFKRelationships(dynamic_cast<Table *>(tab_obj->getParentTable()));
 
-					op_list->registerObject(tab_obj, Operation::ObjCreated, -1, tab_obj->getParentTable());
+						op_list->registerObject(tab_obj, Operation::ObjCreated, -1, tab_obj->getParentTable());
+					}
+					else
+						op_list->registerObject(object, Operation::ObjCreated);
+				}
+				catch(Exception &e)
+				{
+					errors.push_back(e);
 				}
-				else
-					op_list->registerObject(object, Operation::ObjCreated);
-			}
-			catch(Exception &e)
-			{
-				errors.push_back(e);
 			}
 		}
-	}
-	op_list->finishOperationChain();
+		op_list->finishOperationChain();
 
-	//Validates the relationships to reflect any modification on the tables structures and not propagated columns
-	db_model->validateRelationships();
+		//Validates the relationships to reflect any modification on the tables structures and not propagated columns
+		db_model->validateRelationships();
+	}
+	catch(Exception &e)
+	{
+		/* The batch of additions must be always closed, otherwise the objects added to the model
+		 * afterwards would never be notified to the views */
+		db_model->endObjectsAddition();
+		throw Exception(e.getErrorMessage(),e.getErrorCode(),__PRETTY_FUNCTION__,__FILE__,__LINE__, &e);
+	}
 
+	db_model->endObjectsAddition();
 	this->adjustSceneSize();
 	task_prog_wgt.close();
 
@@ -3858,6 +4123,8 @@ void ModelWidget::fadeObjects(const std::vector<BaseObject *> &objects, bool fad
 	BaseObjectView *obj_view = nullptr;
 	Schema *schema = nullptr;
 
+	createDeferredViews();
+
 	for(auto obj : objects)
 	{
 	  schema = dynamic_cast<Schema *>(obj);
@@ -3980,6 +4247,8 @@ void ModelWidget::setAllCollapseMode(BaseTable::CollapseMode mode)
 	BaseTable *base_tab = nullptr;
 	std::vector<BaseObject *> objects;
 
+	createDeferredViews();
+
 	this->scene->clearSelection();
 	objects.assign(db_model->getObjectList(ObjectType::Table)->begin(), db_model->getObjectList(ObjectType::Table)->end());
 	objects.insert(objects.end(), db_model->getObjectList(ObjectType::View)->begin(), db_model->getObjectList(ObjectType::View)->end());
@@ -4037,7 +4306,7 @@ void ModelWidget::moveObjectsInZStack(int direction)
 					zval = item->zValue();
 			}
 
-			op_list->registerObject(obj_view->getUnderlyingObject(), Operation::ObjModified);
+			op_list->registerObject(obj_view->getUnderlyingObject(), Operation::ObjModified, -1, nullptr, Operation::GraphicDelta);
 
 			zval += (1 * direction);
 
@@ -4123,6 +4392,8 @@ void ModelWidget::toggleSchemasRectangles()
 	bool visible = sender() == action_show_schemas_rects;
 	Schema *schema = nullptr;
 
+	createDeferredViews();
+
 	for(auto obj : *db_model->getObjectList(ObjectType::Schema))
 	{
 		schema = dynamic_cast<Schema *>(obj);
@@ -4152,6 +4423,11 @@ void ModelWidget::updateObjectsOpacity()
 		for(auto object : *db_model->getObjectList(type))
 		{
 			base_obj = dynamic_cast<BaseGraphicObject *>(object);
+
+			//Deferred views have their opacity configured when they are created
+			if(base_obj->isOverlyingObjectDeferred())
+				continue;
+
 			obj_view = dynamic_cast<BaseObjectView *>(base_obj->getOverlyingObject());
 
 			if(obj_view &&
@@ -4801,7 +5077,7 @@ void ModelWidget::breakRelationshipLine()
 		QAction *action=dynamic_cast<QAction *>(sender());
 		BaseRelationship *rel=dynamic_cast<BaseRelationship *>(selected_objects[0]);
 
-		op_list->registerObject(rel, Operation::ObjModified);
+		op_list->registerObject(rel, Operation::ObjModified, -1, nullptr, Operation::GraphicDelta);
 		breakRelationshipLine(rel, static_cast<RelBreakMode>(action->data().toInt()));
 		rel->setModified(true);
 		this->setModified(true);
@@ -4876,7 +5152,7 @@ void ModelWidget::removeRelationshipPoints()
 
 				if(!rel->isProtected())
 				{
-					op_list->registerObject(rel, Operation::ObjModified);
+					op_list->registerObject(rel, Operation::ObjModified, -1, nullptr, Operation::GraphicDelta);
 					rel->setPoints({});
 					rel->setModified(true);
 				}
@@ -4885,7 +5161,7 @@ void ModelWidget::removeRelationshipPoints()
 		}
 		else
 		{
-			op_list->registerObject(rel, Operation::ObjModified);
+			op_list->registerObject(rel, Operation::ObjModified, -1, nullptr, Operation::GraphicDelta);
 			rel->setPoints({});
 			rel->setModified(true);
 		}
@@ -4908,6 +5184,8 @@ void ModelWidget::rearrangeSchemasInGrid(unsigned tabs_per_row, unsigned sch_per
 	unsigned sch_id=0, min_cnt = 0;
 	double x=origin.x(), y=origin.y(), max_y=-1, cy=0;
 
+	//The arrangement relies on the dimensions of all the views, so the pending deferred ones are created first
+	createDeferredViews();
 	objects=db_model->getObjectList(ObjectType::Schema);
 
 	/* If schemas per row or tables per row isn't specified
@@ -5112,6 +5390,7 @@ void ModelWidget::rearrangeTablesHierarchically()
 	BaseTableView *tab_view = nullptr, *root = nullptr;
 	int num_rels = 0;
 
+	createDeferredViews();
 	scene->clearSelection();
 
 	objects.assign(db_model->getObjectList(ObjectType::Table)->begin(), db_model->getObjectList(ObjectType::Table)->end());
@@ -5469,7 +5748,7 @@ void ModelWidget::rearrangeTablesInSchemas()
 									 db_model->getObjectCount(ObjectType::ForeignTable) +
 									 db_model->getObjectCount(ObjectType::Schema)) * 50;
 
-
+	createDeferredViews();
 	rand_num_engine.seed(rand_seed());
 
 	/* Rearraging tables inside schemas and determining the maximum width and height by summing
@@ -198,11 +198,42 @@ class __libgui ModelWidget: public QWidget {
 
 		/*! \brief This timer controls the interval that the background of the scene is hidden while
 		 *  using the mouse wheel to zoom or move the scene */
-		wheel_timer;
+		wheel_timer,
+
+		//! \brief This timer creates the deferred objects' views in small batches while the application is idle
+		deferred_views_timer;
+
+		/*! \brief Indicates that the creation of the graphical objects' views must be deferred.
+		 *  This is used while loading models so only the views near to the visible area are created
+		 *  right after the loading, and the remaining ones are created in background or on demand */
+		bool defer_views_creation;
+
+		//! \brief Graphical objects which views' creation were deferred, ordered by creation priority
+		std::vector<BaseGraphicObject *> deferred_objs;
+
+		//! \brief Index of the next object in deferred_objs to be handled by the background creation
+		size_t next_deferred_idx;
+
+		//! \brief Amount of deferred views created each time the deferred_views_timer times out
+		static constexpr unsigned DeferredViewsBatch = 100;
 
 		//! \brief Stores the installed plugins actions to be used in the model context menu
 		QList<QAction *> plugins_actions;
 
+		//! \brief Creates the view that graphically represents the provided object inserting it in the scene
+		QGraphicsItem *createObjectView(BaseGraphicObject *graph_obj);
+
+		/*! \brief Creates the deferred views of the objects positioned in the provided rectangle. Relationships are
+		 *  created only if both tables' views exist and schemas are ignored since they depend on all their children */
+		void createDeferredViews(const QRectF &rect);
+
+		/*! \brief Sorts the deferred objects by creation priority, creates the views near to the visible area
+		 *  and starts the creation of the remaining ones in background */
+		void startDeferredViewsCreation();
+
+		//! \brief Clears the deferred objects list and adjusts the scene rect to the created views
+		void finishDeferredViewsCreation();
+
 		//! \brief Opens a editing form for objects at database level
 		template<class Class, class WidgetClass>
 		int openEditingForm(BaseObject *object);
@@ -377,6 +408,12 @@ class __libgui ModelWidget: public QWidget {
 		rect when some object is out of bound */
 		void adjustSceneSize();
 
+		/*! \brief Immediately creates all the views which creation was deferred during the model loading.
+		 *  This must be called before operations that need the whole model in the scene (e.g. export, print,
+		 *  select all, fade, collapse and objects arrangement). Note that deferring the views only reduces the
+		 *  time to show the diagram, since all views are eventually created the peak memory usage is the same */
+		void createDeferredViews();
+
 		//! \brief Set the model as modified forcing it to be redrawn
 		void setModified(bool value);
 
@@ -454,6 +491,19 @@ class __libgui ModelWidget: public QWidget {
 		//! \brief Handles the signals that indicates the object creation on the reference database model
 		void handleObjectAddition(BaseObject *object);
 
+		/*! \brief Handles the signals that indicates the creation of a batch of objects on the reference
+		 *  database model, creating all the views in a single pass */
+		void handleObjectsAddition(const std::vector<BaseObject *> &objects);
+
+		//! \brief Creates the deferred view of the provided object (called when the object's view is requested)
+		void createDeferredView(BaseGraphicObject *graph_obj);
+
+		//! \brief Creates the deferred views of the objects near to the visible area of the viewport
+		void createVisibleDeferredViews();
+
+		//! \brief Creates the next batch of deferred views in background
+		void createNextDeferredViews();
+
 		//! \brief Handles the signals that indicates the object removal on the reference database model
 		void handleObjectRemoval(BaseObject *object);
 
@@ -186,6 +186,9 @@ void ObjectFinderWidget::selectObjects()
 	BaseGraphicObject *graph_obj = nullptr;
 	bool sel_listed = false;
 
+	//The views of all the objects must exist so the ones not listed can be selected as well
+	model_wgt->createDeferredViews();
+
 	for(auto obj_type : {ObjectType::Table, ObjectType::View, ObjectType::Textbox, ObjectType::Relationship, ObjectType::BaseRelationship, ObjectType::Schema})
 	{
 		objects.insert(objects.end(),
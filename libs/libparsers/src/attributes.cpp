@@ -64,6 +64,7 @@ namespace Attributes {
 	BypassRls("bypassrls"),
 	ByValue("by-value"),
 	Cache("cache"),
+	CacheObjectViews("cache-object-views"),
 	CanonicalFunc("canonical"),
 	CanvasColor("canvas-color"),
 	CanvasCornerMove("canvas-corner-move"),
@@ -372,6 +373,8 @@ namespace Attributes {
 	LockerArc("locker-arc"),
 	LockerBody("locker-body"),
 	LockPageDelimResize("lock-page-delim-resize"),
+	LodBoxZoom("lod-box-zoom"),
+	LodTitleZoom("lod-title-zoom"),
 	Login("login"),
 	LookaheadChar("lookahead-char"),
 	LowVerbosity("low-verbosity"),
@@ -430,6 +433,7 @@ namespace Attributes {
 	OperatorFunc("operfunc"),
 	Operators("operators"),
 	OpFamily("opfamily"),
+	OpListMemory("op-list-memory"),
 	OpListSize("op-list-size"),
 	Options("options"),
 	OriginalPk("original-pk"),
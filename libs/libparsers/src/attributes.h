@@ -77,6 +77,7 @@ namespace Attributes {
 	BypassRls,
 	ByValue,
 	Cache,
+	CacheObjectViews,
 	CanonicalFunc,
 	CanvasColor,
 	CanvasCornerMove,
@@ -387,6 +388,8 @@ namespace Attributes {
 	LockerArc,
 	LockerBody,
 	LockPageDelimResize,
+	LodBoxZoom,
+	LodTitleZoom,
 	Login,
 	LookaheadChar,
 	LowVerbosity,
@@ -445,6 +448,7 @@ namespace Attributes {
 	OperatorFunc,
 	Operators,
 	OpFamily,
+	OpListMemory,
 	OpListSize,
 	Options,
 	OriginalPk,
@@ -28,6 +28,9 @@ XmlParser::XmlParser()
 	curr_elem=nullptr;
 	xml_doc=nullptr;
 	curr_line = 0;
+	prefetch_thread = nullptr;
+	curr_prefetch_elem = nullptr;
+	prefetch_stopped = false;
 
 	if(parser_instances == 0)
 		xmlInitParser();
@@ -239,6 +242,9 @@ void XmlParser::restartNavigation()
 
 void XmlParser::restartParser()
 {
+	//The prefetch thread must be stopped before destroying the element tree
+	stopAttributesPrefetch();
+
 	root_elem=curr_elem=nullptr;
 	curr_line = 0;
 
@@ -375,17 +381,65 @@ const xmlNode *XmlParser::getCurrentElement()
 
 void XmlParser::getElementAttributes(attribs_map &attributes)
 {
-	xmlAttr *elem_attribs=nullptr;
-	QString attrib, value;
-
 	if(!root_elem)
 		throw Exception(ErrorCode::OprNotAllocatedElementTree,__PRETTY_FUNCTION__,__FILE__,__LINE__);
 
+	if(prefetch_thread && curr_elem != root_elem)
+	{
+		const xmlNode *top_elem = curr_elem;
+
+		//Determining the root's child element that contains the current element
+		while(top_elem->parent && top_elem->parent != root_elem)
+			top_elem = top_elem->parent;
+
+		/* When the navigation reaches another root's child we discard the prefetched
+		 * attributes of the previous elements until the ones of the current element are found */
+		if(top_elem != curr_prefetch_elem)
+		{
+			curr_prefetch_elem = top_elem;
+			curr_prefetch.clear();
+
+			prefetch_mutex.lock();
+
+			while(!prefetch_queue.empty())
+			{
+				auto prefetch = std::move(prefetch_queue.front());
+				prefetch_queue.pop_front();
+
+				if(prefetch.first == top_elem)
+				{
+					curr_prefetch = std::move(prefetch.second);
+					break;
+				}
+			}
+
+			prefetch_cond.wakeAll();
+			prefetch_mutex.unlock();
+		}
+
+		auto itr = curr_prefetch.find(curr_elem);
+
+		if(itr != curr_prefetch.end())
+		{
+			attributes = std::move(itr->second);
+			curr_prefetch.erase(itr);
+			return;
+		}
+	}
+
+	getElementAttributes(curr_elem, attributes);
+}
+
+void XmlParser::getElementAttributes(const xmlNode *elem, attribs_map &attributes)
+{
+	xmlAttr *elem_attribs=nullptr;
+	QString attrib, value;
+
 	//Always clears the passed attributes maps
 	attributes.clear();
 
 	//Gets the references to the element properties
-	elem_attribs=curr_elem->properties;
+	elem_attribs=elem->properties;
 
 	while(elem_attribs)
 	{
@@ -403,6 +457,82 @@ void XmlParser::getElementAttributes(attribs_map &attributes)
 	}
 }
 
+void XmlParser::startAttributesPrefetch()
+{
+	if(!root_elem || prefetch_thread || QThread::idealThreadCount() < 2)
+		return;
+
+	prefetch_stopped = false;
+	curr_prefetch_elem = nullptr;
+	prefetch_thread = QThread::create([this](){ prefetchAttributes(); });
+	prefetch_thread->start();
+}
+
+void XmlParser::stopAttributesPrefetch()
+{
+	if(!prefetch_thread)
+		return;
+
+	prefetch_mutex.lock();
+	prefetch_stopped = true;
+	prefetch_cond.wakeAll();
+	prefetch_mutex.unlock();
+
+	prefetch_thread->wait();
+	delete prefetch_thread;
+	prefetch_thread = nullptr;
+
+	prefetch_queue.clear();
+	curr_prefetch.clear();
+	curr_prefetch_elem = nullptr;
+}
+
+void XmlParser::prefetchAttributes()
+{
+	std::stack<const xmlNode *> elems;
+	const xmlNode *elem = nullptr;
+
+	for(const xmlNode *top_elem = root_elem->children; top_elem; top_elem = top_elem->next)
+	{
+		if(top_elem->type != XML_ELEMENT_NODE)
+			continue;
+
+		ElemAttribsMap elem_attribs;
+
+		//Extracting the attributes of the element and all its descendants
+		elems.push(top_elem);
+
+		while(!elems.empty())
+		{
+			elem = elems.top();
+			elems.pop();
+
+			if(elem->properties)
+				getElementAttributes(elem, elem_attribs[elem]);
+
+			for(const xmlNode *child = elem->children; child; child = child->next)
+			{
+				if(child->type == XML_ELEMENT_NODE)
+					elems.push(child);
+			}
+		}
+
+		prefetch_mutex.lock();
+
+		while(!prefetch_stopped && prefetch_queue.size() >= PrefetchWindow)
+			prefetch_cond.wait(&prefetch_mutex);
+
+		if(prefetch_stopped)
+		{
+			prefetch_mutex.unlock();
+			break;
+		}
+
+		prefetch_queue.emplace_back(top_elem, std::move(elem_attribs));
+		prefetch_mutex.unlock();
+	}
+}
+
 QString XmlParser::getLoadedFilename()
 {
 	return xml_doc_filename;
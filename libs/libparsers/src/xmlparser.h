@@ -31,7 +31,12 @@
 #include "schemaparser.h"
 #include "exception.h"
 #include <stack>
+#include <deque>
+#include <unordered_map>
 #include <iostream>
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
 #include "attribsmap.h"
 
 class __libparsers XmlParser {
@@ -71,6 +76,40 @@ class __libparsers XmlParser {
 										 a default declaration. */
 		xml_decl;
 
+		//! \brief Attributes of a root's child element and its descendants indexed by the elements
+		using ElemAttribsMap = std::unordered_map<const xmlNode *, attribs_map>;
+
+		//! \brief Maximum amount of root's children elements which attributes can be extracted in advance
+		static constexpr unsigned PrefetchWindow = 256;
+
+		//! \brief Thread that extracts the elements' attributes in advance (see startAttributesPrefetch())
+		QThread *prefetch_thread;
+
+		//! \brief Controls the access to the prefetched attributes queue between threads
+		QMutex prefetch_mutex;
+
+		//! \brief Used to make the prefetch thread wait while the queue is full
+		QWaitCondition prefetch_cond;
+
+		//! \brief Stores the prefetched attributes of the root's children elements in document order
+		std::deque<std::pair<const xmlNode *, ElemAttribsMap>> prefetch_queue;
+
+		//! \brief Stores the prefetched attributes of the root's child element currently being read
+		ElemAttribsMap curr_prefetch;
+
+		//! \brief The root's child element (or an ancestor of it) currently being read
+		const xmlNode *curr_prefetch_elem;
+
+		//! \brief Indicates that the prefetch thread must stop
+		bool prefetch_stopped;
+
+		//! \brief Stores on a map the attributes of the provided element
+		static void getElementAttributes(const xmlNode *elem, attribs_map &attributes);
+
+		/*! \brief Extracts the attributes of all the root's children elements (and their descendants)
+		 * in document order. This method runs in the prefetch thread */
+		void prefetchAttributes();
+
 		/*! \brief Remove the original DTD from the document. This is done to evit that
 		 the user insert some external dtd in the model file that is not valid for pgModeler */
 		void removeDTD();
@@ -127,6 +166,18 @@ class __libparsers XmlParser {
 		//! \brief Stores on a map the atrributes (names and values) of the current element
 		void getElementAttributes(attribs_map &attributes);
 
+		/*! \brief Starts a thread that extracts in advance the attributes of the root's children elements
+		 * (and their descendants) while the document is navigated, e.g., while objects are created from the
+		 * elements already read. The prefetched attributes are returned by getElementAttributes() as the
+		 * navigation reaches their elements. The navigation must move forward through the root's children,
+		 * otherwise the attributes are just extracted in the calling thread as usual.
+		 * Nothing is done if the document isn't loaded or there's only one processor available */
+		void startAttributesPrefetch();
+
+		/*! \brief Stops the prefetch thread discarding any attribute not consumed yet.
+		 * This method is called automatically by restartParser() */
+		void stopAttributesPrefetch();
+
 		/*! \brief Returns the content text of the element, used only for elements which do not have children
 		 and that are filled by simple texts */
 		QString getElementContent();
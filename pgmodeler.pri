@@ -202,7 +202,7 @@ DEFINES += BINDIR=\\\"$${BINDIR}\\\" \
 		   SCHEMASDIR=\\\"$${SCHEMASDIR}\\\"
 
 
-# pgModeler depends on libpq and libxml2 this way to variables
+# pgModeler depends on libpq, libxml2 and zlib this way to variables
 # are define so the compiler can find the libs at link time.
 #
 # PGSQL_LIB -> Full path to libpq.(so | dll | dylib)
@@ -210,6 +210,9 @@ DEFINES += BINDIR=\\\"$${BINDIR}\\\" \
 #
 # XML_LIB   -> Full path to libxml2.(so | dll | dylib)
 # XML_INC   -> Root path where XML2 includes can be found
+#
+# ZLIB_LIB  -> Full path to libz.(so | dll | dylib)
+# ZLIB_INC  -> Root path where zlib includes can be found
 
 linux: {
   # If all custom variables PGSQL_??? and XML_??? are defined
@@ -224,10 +227,15 @@ linux: {
   # Then we default to use pkg-config for libpq and libxml-2.0
   !defined(has_dep_paths,var): {
     CONFIG += link_pkgconfig
-	PKGCONFIG = libpq libxml-2.0
+	PKGCONFIG = libpq libxml-2.0 zlib
 	PGSQL_LIB = -lpq
 	XML_LIB = -lxml2
   }
+
+  # zlib is usually installed in the system paths so when its
+  # custom paths are not defined we just link against it
+  !defined(ZLIB_LIB, var): ZLIB_LIB = -lz
+  defined(ZLIB_INC, var): INCLUDEPATH += "$$ZLIB_INC"
 }
 
 macx {
@@ -235,7 +243,9 @@ macx {
   !defined(PGSQL_INC, var): PGSQL_INC = /Library/PostgreSQL/14/include
   !defined(XML_INC, var): XML_INC = /Library/Developer/CommandLineTools/SDKs/MacOSX.sdk/usr/include/libxml2
   !defined(XML_LIB, var): XML_LIB = /Library/Developer/CommandLineTools/SDKs/MacOSX.sdk/usr/lib/libxml2.tbd
-  INCLUDEPATH += "$$PGSQL_INC" "$$XML_INC"
+  !defined(ZLIB_INC, var): ZLIB_INC = /Library/Developer/CommandLineTools/SDKs/MacOSX.sdk/usr/include
+  !defined(ZLIB_LIB, var): ZLIB_LIB = /Library/Developer/CommandLineTools/SDKs/MacOSX.sdk/usr/lib/libz.tbd
+  INCLUDEPATH += "$$PGSQL_INC" "$$XML_INC" "$$ZLIB_INC"
 }
 
 windows {
@@ -243,7 +253,9 @@ windows {
   !defined(PGSQL_INC, var): PGSQL_INC = C:/msys64/mingw64/include
   !defined(XML_INC, var): XML_INC = C:/msys64/mingw64/include/libxml2
   !defined(XML_LIB, var): XML_LIB = C:/msys64/mingw64/bin/libxml2-2.dll
-  INCLUDEPATH += "$$PGSQL_INC" "$$XML_INC"
+  !defined(ZLIB_INC, var): ZLIB_INC = C:/msys64/mingw64/include
+  !defined(ZLIB_LIB, var): ZLIB_LIB = C:/msys64/mingw64/bin/zlib1.dll
+  INCLUDEPATH += "$$PGSQL_INC" "$$XML_INC" "$$ZLIB_INC"
 }
 
 linux:defined(has_dep_paths,var) | macx | windows : {
@@ -271,6 +283,20 @@ linux:defined(has_dep_paths,var) | macx | windows : {
     VALUE = $$XML_INC
   }
 
+  macx | windows : {
+    !exists($$ZLIB_LIB) {
+      PKG_ERROR = "zlib libraries"
+      VARIABLE = "ZLIB_LIB"
+      VALUE = $$ZLIB_LIB
+    }
+
+    !exists($$ZLIB_INC/zlib.h) {
+      PKG_ERROR = "zlib headers"
+      VARIABLE = "ZLIB_INC"
+      VALUE = $$ZLIB_INC
+    }
+  }
+
   !isEmpty(PKG_ERROR) {
     warning("$$PKG_ERROR were not found at \"$$VALUE\"!")
     warning("Please correct the value of $$VARIABLE and try again!")
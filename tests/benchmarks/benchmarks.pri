@@ -0,0 +1,9 @@
+include(../tests.pri)
+
+INCLUDEPATH += $$PWD/src
+
+HEADERS += $$PWD/src/syntheticmodelgenerator.h
+SOURCES += $$PWD/src/syntheticmodelgenerator.cpp
+
+# Deployment settings
+target.path = $$BINDIR/benchmarks
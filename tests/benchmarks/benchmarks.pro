@@ -0,0 +1,14 @@
+# Benchmarks subproject. The executables are installed in $$BINDIR/benchmarks
+# so they are not executed by the runtests app together with the unit tests.
+#
+# Each benchmark is a QtTest executable using QBENCHMARK so the results can be
+# exported in a machine-readable format to compare different runs, e.g.:
+#
+#   corebenchmark -o results.xml,xml
+#   corebenchmark -o results.csv,csv
+#
+# See syntheticmodelgenerator.h for the environment variables that control
+# the models used by the benchmarks.
+TEMPLATE = subdirs
+SUBDIRS = src/corebenchmark \
+	  src/canvasbenchmark
@@ -0,0 +1,164 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "databasemodel.h"
+#include "objectsscene.h"
+#include "pgmodelerunittest.h"
+#include "syntheticmodelgenerator.h"
+
+class CanvasBenchmark: public QObject, public PgModelerUnitTest {
+	private:
+		Q_OBJECT
+
+		//! \brief Amount of tables (each one linked to the previous one in the same schema) moved at once
+		static constexpr unsigned DraggedTables = 500,
+
+		//! \brief Amount of mouse move events simulated in each drag
+		DragSteps = 20,
+
+		//! \brief Amount of frames rendered in each pan of the canvas
+		PanSteps = 50,
+
+		//! \brief Offset (in pixels) applied to the visible area of the canvas between two frames of the pan
+		PanOffset = 10;
+
+		//! \brief Size of the frames rendered while panning the canvas
+		static constexpr QSize FrameSize { 1920, 1080 };
+
+		//! \brief Creates the views of the tables and relationships of the provided model in the scene
+		void createViews(DatabaseModel &model, ObjectsScene &scene, QList<TableView *> &tab_views);
+
+	public:
+		CanvasBenchmark() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private slots:
+		void initTestCase();
+		void dragConnectedTables();
+		void panCanvas_data();
+		void panCanvas();
+};
+
+void CanvasBenchmark::initTestCase()
+{
+	/* Disabling placeholders so the relationships are updated on each table movement
+	 * (the same behavior of dragging tables without placeholders in the canvas) */
+	BaseObjectView::setPlaceholderEnabled(false);
+}
+
+void CanvasBenchmark::createViews(DatabaseModel &model, ObjectsScene &scene, QList<TableView *> &tab_views)
+{
+	SyntheticModelGenerator generator;
+
+	generator.generateModel(model, DraggedTables);
+
+	for(auto &obj : *model.getObjectList(ObjectType::Table))
+	{
+		tab_views.append(new TableView(dynamic_cast<Table *>(obj)));
+		scene.addItem(tab_views.back());
+	}
+
+	for(auto &obj : *model.getObjectList(ObjectType::BaseRelationship))
+		scene.addItem(new RelationshipView(dynamic_cast<BaseRelationship *>(obj)));
+
+	scene.updatePendingRelationships();
+}
+
+void CanvasBenchmark::dragConnectedTables()
+{
+	DatabaseModel model;
+	ObjectsScene scene;
+	QList<TableView *> tab_views;
+
+	try
+	{
+		createViews(model, scene, tab_views);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+
+	QBENCHMARK
+	{
+		for(unsigned step = 0; step < DragSteps; step++)
+		{
+			// Each step simulates a mouse move event moving all tables followed by a frame
+			for(auto &tab_view : tab_views)
+				tab_view->moveBy(1, 1);
+
+			scene.updatePendingRelationships();
+		}
+	}
+}
+
+void CanvasBenchmark::panCanvas_data()
+{
+	QTest::addColumn<bool>("item_cache");
+
+	QTest::newRow("direct rendering") << false;
+	QTest::newRow("item cache") << true;
+}
+
+void CanvasBenchmark::panCanvas()
+{
+	QFETCH(bool, item_cache);
+
+	DatabaseModel model;
+	ObjectsScene scene;
+	QList<TableView *> tab_views;
+	QImage frame(FrameSize, QImage::Format_ARGB32_Premultiplied);
+	QPainter painter;
+	QRectF items_rect;
+
+	// The item cache mode is applied to the objects when they are configured so it must be set before creating the views
+	BaseObjectView::setItemCacheEnabled(item_cache);
+
+	try
+	{
+		createViews(model, scene, tab_views);
+	}
+	catch(Exception &e)
+	{
+		BaseObjectView::setItemCacheEnabled(false);
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+
+	items_rect = scene.itemsBoundingRect();
+	painter.begin(&frame);
+	painter.setRenderHint(QPainter::Antialiasing, true);
+	painter.setRenderHint(QPainter::TextAntialiasing, true);
+
+	QBENCHMARK
+	{
+		for(unsigned step = 0; step < PanSteps; step++)
+		{
+			/* Each step renders a frame of the canvas moved diagonally by a few pixels
+			 * as it happens when the user scrolls or pans the canvas */
+			frame.fill(Qt::white);
+			scene.render(&painter, QRectF(frame.rect()),
+									 QRectF(items_rect.topLeft() + QPointF(step * PanOffset, step * PanOffset), QSizeF(FrameSize)));
+		}
+	}
+
+	painter.end();
+	BaseObjectView::setItemCacheEnabled(false);
+}
+
+QTEST_MAIN(CanvasBenchmark)
+#include "canvasbenchmark.moc"
@@ -0,0 +1,251 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "databasemodel.h"
+#include "tools/modelsdiffhelper.h"
+#include "pgmodelerunittest.h"
+#include "syntheticmodelgenerator.h"
+
+class CoreBenchmark: public QObject, public PgModelerUnitTest {
+	private:
+		Q_OBJECT
+
+		//! \brief Temporary directory where the synthetic models are saved
+		QTemporaryDir tmp_dir;
+
+		//! \brief Adds a data row for each sample and synthetic model file
+		void addModelsData();
+
+		//! \brief Loads the model file in the current data row into the provided model
+		void loadDataModel(DatabaseModel &model);
+
+	public:
+		CoreBenchmark() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private slots:
+		void initTestCase();
+
+		void loadModel_data();
+		void loadModel();
+
+		void saveXmlCode_data();
+		void saveXmlCode();
+
+		void generateSqlCode_data();
+		void generateSqlCode();
+
+		void getCreationOrder_data();
+		void getCreationOrder();
+
+		void getObjectReferences_data();
+		void getObjectReferences();
+
+		void diffModels_data();
+		void diffModels();
+
+		void schemaParserTemplating_data();
+		void schemaParserTemplating();
+};
+
+void CoreBenchmark::initTestCase()
+{
+	SyntheticModelGenerator generator;
+
+	QVERIFY(tmp_dir.isValid());
+
+	try
+	{
+		for(auto &size : SyntheticModelGenerator::getModelSizes())
+			generator.generateModelFile(tmp_dir.filePath(QString("synthetic_%1.dbm").arg(size)), size);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CoreBenchmark::addModelsData()
+{
+	QTest::addColumn<QString>("filename");
+
+	for(auto &sample : SyntheticModelGenerator::getSampleModels())
+		QTest::addRow("%s", QFileInfo(sample).fileName().toStdString().c_str()) << sample;
+
+	for(auto &size : SyntheticModelGenerator::getModelSizes())
+	{
+		QTest::addRow("synthetic_%u", size)
+				<< tmp_dir.filePath(QString("synthetic_%1.dbm").arg(size));
+	}
+}
+
+void CoreBenchmark::loadDataModel(DatabaseModel &model)
+{
+	QFETCH(QString, filename);
+
+	try
+	{
+		model.createSystemObjects(false);
+		model.loadModel(filename);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void CoreBenchmark::loadModel_data()
+{
+	addModelsData();
+}
+
+void CoreBenchmark::loadModel()
+{
+	QFETCH(QString, filename);
+
+	QBENCHMARK
+	{
+		DatabaseModel model;
+		model.createSystemObjects(false);
+		model.loadModel(filename);
+	}
+}
+
+void CoreBenchmark::saveXmlCode_data()
+{
+	addModelsData();
+}
+
+void CoreBenchmark::saveXmlCode()
+{
+	DatabaseModel model;
+	loadDataModel(model);
+
+	QBENCHMARK
+	{
+		// Invalidating the cached codes so the whole XML is generated again
+		model.setCodesInvalidated();
+		model.getSourceCode(SchemaParser::XmlCode);
+	}
+}
+
+void CoreBenchmark::generateSqlCode_data()
+{
+	addModelsData();
+}
+
+void CoreBenchmark::generateSqlCode()
+{
+	DatabaseModel model;
+	loadDataModel(model);
+
+	QBENCHMARK
+	{
+		model.setCodesInvalidated();
+		model.getSourceCode(SchemaParser::SqlCode, true);
+	}
+}
+
+void CoreBenchmark::getCreationOrder_data()
+{
+	addModelsData();
+}
+
+void CoreBenchmark::getCreationOrder()
+{
+	DatabaseModel model;
+	loadDataModel(model);
+
+	QBENCHMARK
+	{
+		model.getCreationOrder(SchemaParser::SqlCode, true, true);
+	}
+}
+
+void CoreBenchmark::getObjectReferences_data()
+{
+	addModelsData();
+}
+
+void CoreBenchmark::getObjectReferences()
+{
+	DatabaseModel model;
+	std::vector<BaseObject *> refs, objects;
+
+	loadDataModel(model);
+
+	for(auto &obj : model.getCreationOrder(SchemaParser::XmlCode))
+		objects.push_back(obj.second);
+
+	QBENCHMARK
+	{
+		for(auto &obj : objects)
+			model.getObjectReferences(obj, refs);
+	}
+}
+
+void CoreBenchmark::diffModels_data()
+{
+	addModelsData();
+}
+
+void CoreBenchmark::diffModels()
+{
+	DatabaseModel src_model, imp_model;
+	ModelsDiffHelper diff_helper;
+
+	loadDataModel(src_model);
+	loadDataModel(imp_model);
+
+	QBENCHMARK
+	{
+		diff_helper.setModels(&src_model, &imp_model);
+		diff_helper.diffModels();
+	}
+}
+
+void CoreBenchmark::schemaParserTemplating_data()
+{
+	addModelsData();
+}
+
+void CoreBenchmark::schemaParserTemplating()
+{
+	DatabaseModel model;
+	std::vector<BaseObject *> objects;
+
+	loadDataModel(model);
+
+	for(auto &obj : model.getCreationOrder(SchemaParser::SqlCode))
+	{
+		if(obj.second->getObjectType() != ObjectType::Database)
+			objects.push_back(obj.second);
+	}
+
+	QBENCHMARK
+	{
+		// Forcing the schema parser to process the templates of each object
+		model.setCodesInvalidated();
+
+		for(auto &obj : objects)
+			obj->getSourceCode(SchemaParser::SqlCode);
+	}
+}
+
+QTEST_MAIN(CoreBenchmark)
+#include "corebenchmark.moc"
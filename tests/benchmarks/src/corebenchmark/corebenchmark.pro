@@ -0,0 +1,2 @@
+include(../../benchmarks.pri)
+SOURCES += corebenchmark.cpp
@@ -0,0 +1,154 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include "syntheticmodelgenerator.h"
+#include "globalattributes.h"
+#include <QDir>
+
+SyntheticModelGenerator::SyntheticModelGenerator(unsigned tables_per_schema, unsigned columns_per_table)
+{
+	this->tables_per_schema = std::max<unsigned>(tables_per_schema, 1);
+	this->columns_per_table = columns_per_table;
+}
+
+void SyntheticModelGenerator::generateModel(DatabaseModel &model, unsigned table_count)
+{
+	Schema *schema = nullptr;
+	Role *role = nullptr;
+	Table *table = nullptr, *prev_table = nullptr;
+	Column *column = nullptr, *id_col = nullptr, *fk_col = nullptr;
+	Constraint *pk = nullptr, *fk = nullptr;
+	Permission *perm = nullptr;
+	unsigned tab_idx = 0, col_idx = 0, sch_idx = 0;
+
+	model.setName("synthetic");
+	model.createSystemObjects(false);
+
+	role = new Role;
+	role->setName("bench_role");
+	model.addRole(role);
+
+	for(tab_idx = 0; tab_idx < table_count; tab_idx++)
+	{
+		// Creating a new schema each time the previous one is full
+		if(tab_idx % tables_per_schema == 0)
+		{
+			schema = new Schema;
+			schema->setName(QString("schema_%1").arg(sch_idx));
+			schema->setRectVisible(true);
+			model.addSchema(schema);
+			prev_table = nullptr;
+			sch_idx++;
+		}
+
+		table = new Table;
+		table->setName(QString("table_%1").arg(tab_idx));
+		table->setSchema(schema);
+		table->setPosition(QPointF((tab_idx % tables_per_schema) * 250, (sch_idx - 1) * 600));
+
+		id_col = new Column;
+		id_col->setName("id");
+		id_col->setType(PgSqlType("integer"));
+		id_col->setNotNull(true);
+		table->addColumn(id_col);
+
+		for(col_idx = 0; col_idx < columns_per_table; col_idx++)
+		{
+			column = new Column;
+			column->setName(QString("column_%1").arg(col_idx));
+			column->setType(PgSqlType(col_idx % 2 == 0 ? "varchar" : "bigint"));
+			table->addColumn(column);
+		}
+
+		pk = new Constraint;
+		pk->setName(QString("table_%1_pk").arg(tab_idx));
+		pk->setConstraintType(ConstraintType::PrimaryKey);
+		pk->addColumn(id_col, Constraint::SourceCols);
+		table->addConstraint(pk);
+
+		// Linking the table to the previous one in the same schema
+		if(prev_table)
+		{
+			fk_col = new Column;
+			fk_col->setName(QString("%1_id").arg(prev_table->getName()));
+			fk_col->setType(PgSqlType("integer"));
+			table->addColumn(fk_col);
+
+			fk = new Constraint;
+			fk->setName(QString("table_%1_fk").arg(tab_idx));
+			fk->setConstraintType(ConstraintType::ForeignKey);
+			fk->setReferencedTable(prev_table);
+			fk->addColumn(fk_col, Constraint::SourceCols);
+			fk->addColumn(prev_table->getColumn("id"), Constraint::ReferencedCols);
+			table->addConstraint(fk);
+		}
+
+		model.addTable(table);
+
+		// Granting SELECT on each column to the role (per-column grants)
+		for(auto &obj : *table->getObjectList(ObjectType::Column))
+		{
+			perm = new Permission(obj);
+			perm->addRole(role);
+			perm->setPrivilege(Permission::PrivSelect, true, false);
+			model.addPermission(perm);
+		}
+
+		prev_table = table;
+	}
+
+	model.updateTablesFKRelationships();
+}
+
+void SyntheticModelGenerator::generateModelFile(const QString &filename, unsigned table_count)
+{
+	DatabaseModel model;
+	generateModel(model, table_count);
+	model.saveModel(filename, SchemaParser::XmlCode);
+}
+
+QList<unsigned> SyntheticModelGenerator::getModelSizes()
+{
+	QList<unsigned> sizes;
+	QString env_sizes = qEnvironmentVariable("PGMODELER_BENCH_SIZES", "100,1000");
+
+	for(auto &size : env_sizes.split(',', Qt::SkipEmptyParts))
+	{
+		if(size.trimmed().toUInt() > 0)
+			sizes.append(size.trimmed().toUInt());
+	}
+
+	return sizes;
+}
+
+QStringList SyntheticModelGenerator::getSampleModels()
+{
+	QStringList samples;
+	QDir samples_dir(SAMPLESDIR);
+	QString env_samples = qEnvironmentVariable("PGMODELER_BENCH_SAMPLES");
+
+	if(env_samples.isEmpty())
+		samples = samples_dir.entryList({ "*.dbm" }, QDir::Files, QDir::Name);
+	else
+		samples = env_samples.split(',', Qt::SkipEmptyParts);
+
+	for(auto &sample : samples)
+		sample = samples_dir.absoluteFilePath(sample.trimmed());
+
+	return samples;
+}
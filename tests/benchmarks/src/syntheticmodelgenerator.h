@@ -0,0 +1,60 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+/**
+\ingroup tests
+\class SyntheticModelGenerator
+\brief Creates database models of configurable size to be used by the benchmarks.
+The generated model has schemas containing tables with a primary key, a foreign key to
+the previous table in the same schema and per-column permissions granted to a role.
+The following environment variables control the models used by the benchmarks:
+> PGMODELER_BENCH_SIZES: comma separated list of table counts of the synthetic models (default: 100,1000)
+> PGMODELER_BENCH_SAMPLES: comma separated list of sample models (in SAMPLESDIR) to use (default: all *.dbm files)
+*/
+
+#ifndef SYNTHETIC_MODEL_GENERATOR_H
+#define SYNTHETIC_MODEL_GENERATOR_H
+
+#include "databasemodel.h"
+
+class SyntheticModelGenerator {
+	private:
+		//! \brief Amount of tables created in each schema
+		unsigned tables_per_schema,
+
+		//! \brief Amount of columns (excluding the primary/foreign key ones) created in each table
+		columns_per_table;
+
+	public:
+		SyntheticModelGenerator(unsigned tables_per_schema = 50, unsigned columns_per_table = 10);
+
+		/*! \brief Populates the provided model with the amount of tables specified,
+		 * creating as many schemas as needed according to the tables per schema setting */
+		void generateModel(DatabaseModel &model, unsigned table_count);
+
+		//! \brief Generates a model with the amount of tables specified and saves it to the provided file
+		void generateModelFile(const QString &filename, unsigned table_count);
+
+		//! \brief Returns the table counts configured in PGMODELER_BENCH_SIZES
+		static QList<unsigned> getModelSizes();
+
+		//! \brief Returns the full path to the sample models configured in PGMODELER_BENCH_SAMPLES
+		static QStringList getSampleModels();
+};
+
+#endif
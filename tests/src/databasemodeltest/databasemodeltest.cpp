@@ -31,6 +31,14 @@ class DatabaseModelTest: public QObject, public PgModelerUnitTest {
 		void saveObjectsMetadata();
 		void loadObjectsMetadata();
 		void saveSplitSQLDefinition();
+		void saveIncrementalSplitSQLDefinition();
+		void findAndRemovePermissions();
+		void findModifiedPermission();
+		void findPermissionOfRenamedObject();
+		void loadFilteredViewWithExpressionTables();
+		void loadFilteredTablesWithRelationships();
+		void loadChainOfDependentRelationships();
+		void recomputeCreationOrderOnObjectsChanges();
 };
 
 void DatabaseModelTest::saveObjectsMetadata()
@@ -102,5 +110,484 @@ void DatabaseModelTest::saveSplitSQLDefinition()
 	}
 }
 
+void DatabaseModelTest::saveIncrementalSplitSQLDefinition()
+{
+	DatabaseModel dbmodel;
+	QString output=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DirSeparator + "demo_incr_split_test",
+			input_dbm=SAMPLESDIR + GlobalAttributes::DirSeparator + QString("demo.dbm"),
+			manifest=output + GlobalAttributes::DirSeparator + DatabaseModel::SplitManifestFile;
+
+	try
+	{
+		QDir dir(output);
+		QStringList files;
+		QByteArray orig_buffer;
+
+		dir.removeRecursively();
+		dbmodel.createSystemObjects(false);
+		dbmodel.loadModel(input_dbm);
+		dbmodel.saveSplitSQLDefinition(output, DatabaseModel::OriginalSql, true);
+		QVERIFY(QFileInfo::exists(manifest));
+
+		files=dir.entryList({ "*.sql" }, QDir::Files, QDir::Name);
+		QVERIFY(!files.isEmpty());
+
+		// A file changed on disk must be restored by the next incremental export even though its hash is in the manifest
+		QString changed_file=output + GlobalAttributes::DirSeparator + files.last();
+		orig_buffer=UtilsNs::loadFile(changed_file);
+		UtilsNs::saveFile(changed_file, "-- changed");
+
+		// An obsolete file listed in the manifest must be removed
+		QString obsolete_file=output + GlobalAttributes::DirSeparator + "obsolete.sql";
+		UtilsNs::saveFile(obsolete_file, "-- obsolete");
+		UtilsNs::saveFile(manifest, UtilsNs::loadFile(manifest) +
+											QString("%1  obsolete.sql\n").arg(QString(QCryptographicHash::hash("-- obsolete", QCryptographicHash::Md5).toHex())).toUtf8());
+
+		dbmodel.saveSplitSQLDefinition(output, DatabaseModel::OriginalSql, true);
+		QCOMPARE(UtilsNs::loadFile(changed_file), orig_buffer);
+		QVERIFY(!QFileInfo::exists(obsolete_file));
+		QCOMPARE(dir.entryList({ "*.sql" }, QDir::Files, QDir::Name), files);
+
+		/* The exported objects are marked so their code isn't generated again in the next incremental exports.
+		 * Once an object is changed the mark is removed and its file is rewritten */
+		Table *table=dbmodel.getTable(0);
+		QVERIFY(table->isCodeExported());
+
+		table->setComment("changed comment");
+		QVERIFY(!table->isCodeExported());
+
+		dbmodel.saveSplitSQLDefinition(output, DatabaseModel::OriginalSql, true);
+		QVERIFY(table->isCodeExported());
+
+		files=dir.entryList({ QString("*_%1.sql").arg(table->getObjectId()) }, QDir::Files);
+		QCOMPARE(files.size(), 1);
+		QVERIFY(QString(UtilsNs::loadFile(output + GlobalAttributes::DirSeparator + files[0])).contains("changed comment"));
+
+		// A non incremental export must discard the manifest
+		dbmodel.saveSplitSQLDefinition(output);
+		QVERIFY(!QFileInfo::exists(manifest));
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::findAndRemovePermissions()
+{
+	DatabaseModel dbmodel;
+	Schema *schema=new Schema;
+	Role *role=new Role;
+	Permission *perm=nullptr, *dup_perm=nullptr, *aux_perm=nullptr;
+	std::vector<Permission *> perms;
+	bool dup_error=false;
+
+	schema->setName("schema_a");
+	role->setName("role_a");
+	dbmodel.addSchema(schema);
+	dbmodel.addRole(role);
+
+	perm=new Permission(schema);
+	perm->addRole(role);
+	perm->setPrivilege(Permission::PrivUsage, true, false);
+	dbmodel.addPermission(perm);
+
+	dup_perm=new Permission(schema);
+	dup_perm->addRole(role);
+	dup_perm->setPrivilege(Permission::PrivCreate, true, false);
+
+	try
+	{
+		dbmodel.addPermission(dup_perm);
+	}
+	catch(Exception &)
+	{
+		dup_error=true;
+	}
+
+	QCOMPARE(dup_error, true);
+	QCOMPARE(dbmodel.findPermission(dup_perm, false), perm);
+	QVERIFY(dbmodel.findPermission(dup_perm, true) == nullptr);
+
+	aux_perm=new Permission(schema);
+	aux_perm->addRole(role);
+	aux_perm->setPrivilege(Permission::PrivUsage, true, false);
+	QCOMPARE(dbmodel.findPermission(aux_perm, true), perm);
+	QCOMPARE(dbmodel.getPermissionIndex(aux_perm, true), 0);
+
+	dbmodel.getPermissions(schema, perms);
+	QCOMPARE(perms.size(), static_cast<size_t>(1));
+
+	dbmodel.removePermissions(schema);
+	dbmodel.getPermissions(schema, perms);
+	QCOMPARE(perms.empty(), true);
+	QVERIFY(dbmodel.findPermission(aux_perm, true) == nullptr);
+	QCOMPARE(dbmodel.getObjectCount(ObjectType::Permission), 0u);
+
+	delete dup_perm;
+	delete aux_perm;
+}
+
+void DatabaseModelTest::findModifiedPermission()
+{
+	DatabaseModel dbmodel;
+	Schema *schema=new Schema, ext_schema;
+	Role *role=new Role;
+	Permission *perm=nullptr;
+	Permission edited_perm(schema), ext_perm(&ext_schema);
+
+	schema->setName("schema_a");
+	role->setName("role_a");
+	dbmodel.addSchema(schema);
+	dbmodel.addRole(role);
+
+	perm=new Permission(schema);
+	perm->addRole(role);
+	perm->setPrivilege(Permission::PrivUsage, true, false);
+	dbmodel.addPermission(perm);
+
+	/* The external permission is applied to an object that is not in the model (like the ones
+	 * of another model being compared) so the lookup is made through the similarity keys index */
+	ext_schema.setName("schema_a");
+	ext_perm.addRole(role);
+	ext_perm.setPrivilege(Permission::PrivUsage, true, false);
+	QCOMPARE(dbmodel.findPermission(&ext_perm, true), perm);
+
+	// Modifying the permission in place the same way the permission editing form does
+	edited_perm.addRole(role);
+	edited_perm.setPrivilege(Permission::PrivCreate, true, false);
+	(*perm)=edited_perm;
+	dbmodel.invalidatePermissionsIndex();
+
+	QVERIFY(dbmodel.findPermission(&ext_perm, true) == nullptr);
+
+	ext_perm.setPrivilege(Permission::PrivUsage, false, false);
+	ext_perm.setPrivilege(Permission::PrivCreate, true, false);
+	QCOMPARE(dbmodel.findPermission(&ext_perm, true), perm);
+}
+
+void DatabaseModelTest::findPermissionOfRenamedObject()
+{
+	DatabaseModel dbmodel;
+	Schema *schema=new Schema, ext_schema;
+	Role *role=new Role;
+	Permission *perm=nullptr;
+	Permission ext_perm(&ext_schema);
+
+	schema->setName("schema_a");
+	role->setName("role_a");
+	dbmodel.addSchema(schema);
+	dbmodel.addRole(role);
+
+	perm=new Permission(schema);
+	perm->addRole(role);
+	perm->setPrivilege(Permission::PrivUsage, true, false);
+	dbmodel.addPermission(perm);
+
+	ext_schema.setName("schema_a");
+	ext_perm.addRole(role);
+	ext_perm.setPrivilege(Permission::PrivUsage, true, false);
+	QCOMPARE(dbmodel.findPermission(&ext_perm, true), perm);
+
+	// Renaming the objects referenced by the permission must discard the similarity keys index automatically
+	schema->setName("schema_b");
+	QVERIFY(dbmodel.findPermission(&ext_perm, true) == nullptr);
+
+	ext_schema.setName("schema_b");
+	QCOMPARE(dbmodel.findPermission(&ext_perm, true), perm);
+
+	/* Both permissions share the renamed role so they remain similar, but the permission is
+	 * found only if its outdated key (using the former role name) was removed from the index */
+	role->setName("role_b");
+	QCOMPARE(dbmodel.findPermission(&ext_perm, true), perm);
+}
+
+void DatabaseModelTest::loadFilteredViewWithExpressionTables()
+{
+	DatabaseModel dbmodel, filtered_model;
+	QString output=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DirSeparator + "filtered_view_test.dbm";
+
+	try
+	{
+		Schema *schema=nullptr;
+		Table *table=nullptr;
+		Column *col=nullptr;
+		View *view=new View, *aux_view=nullptr;
+		std::vector<PhysicalTable *> ref_tables;
+
+		dbmodel.setName("filtered_view_test");
+		dbmodel.createSystemObjects(true);
+		schema=dbmodel.getSchema("public");
+
+		for(auto &tab_name : { "table_a", "table_b" })
+		{
+			table=new Table;
+			table->setName(tab_name);
+			table->setSchema(schema);
+
+			col=new Column;
+			col->setName("id");
+			col->setType(PgSqlType("integer"));
+			table->addColumn(col);
+
+			dbmodel.addTable(table);
+		}
+
+		// The view references table_a only through its definition expression
+		Reference ref("SELECT id FROM public.table_a", "");
+		ref.addReferencedTable(dbmodel.getTable("public.table_a"));
+		ref.addColumn("id", PgSqlType("integer"), "");
+
+		view->setName("view_a");
+		view->setSchema(schema);
+		view->addReference(ref, Reference::SqlViewDef);
+		dbmodel.addView(view);
+		dbmodel.saveModel(output, SchemaParser::XmlCode);
+
+		filtered_model.createSystemObjects(false);
+		filtered_model.loadModel(output, { QString("view:view_a:%1").arg(UtilsNs::FilterWildcard) });
+
+		aux_view=filtered_model.getView("public.view_a");
+		QVERIFY(aux_view != nullptr);
+		QVERIFY(filtered_model.getTable("public.table_a") != nullptr);
+		QVERIFY(filtered_model.getTable("public.table_b") == nullptr);
+
+		ref_tables=aux_view->getReference(0, Reference::SqlViewDef).getReferencedTables();
+		QCOMPARE(ref_tables.size(), static_cast<size_t>(1));
+		QCOMPARE(ref_tables[0], filtered_model.getTable("public.table_a"));
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::loadFilteredTablesWithRelationships()
+{
+	DatabaseModel dbmodel;
+	QString output=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DirSeparator + "filtered_rels_test.dbm";
+
+	try
+	{
+		Schema *schema=nullptr;
+		Table *table=nullptr;
+		Column *col=nullptr;
+		Constraint *pk=nullptr;
+		Relationship *rel=nullptr;
+
+		dbmodel.setName("filtered_rels_test");
+		dbmodel.createSystemObjects(true);
+		schema=dbmodel.getSchema("public");
+
+		for(auto &tab_name : { "table_a", "table_b", "table_c", "table_child" })
+		{
+			table=new Table;
+			table->setName(tab_name);
+			table->setSchema(schema);
+
+			// The child table receives its columns from the parent one through inheritance
+			if(QString(tab_name) != "table_child")
+			{
+				col=new Column;
+				col->setName(QString("id_%1").arg(tab_name));
+				col->setType(PgSqlType("integer"));
+				col->setNotNull(true);
+				table->addColumn(col);
+
+				pk=new Constraint;
+				pk->setName(QString("%1_pk").arg(tab_name));
+				pk->setConstraintType(ConstraintType::PrimaryKey);
+				pk->addColumn(col, Constraint::SourceCols);
+				table->addConstraint(pk);
+			}
+
+			dbmodel.addTable(table);
+		}
+
+		// Creating the chain table_a -> table_b -> table_c and the inheritance table_child -> table_a
+		rel=new Relationship(BaseRelationship::Relationship1n, dbmodel.getTable("public.table_a"), dbmodel.getTable("public.table_b"));
+		rel->setName("rel_a_b");
+		dbmodel.addRelationship(rel);
+
+		rel=new Relationship(BaseRelationship::Relationship1n, dbmodel.getTable("public.table_b"), dbmodel.getTable("public.table_c"));
+		rel->setName("rel_b_c");
+		dbmodel.addRelationship(rel);
+
+		rel=new Relationship(BaseRelationship::RelationshipGen, dbmodel.getTable("public.table_child"), dbmodel.getTable("public.table_a"));
+		rel->setName("rel_child_a");
+		dbmodel.addRelationship(rel);
+
+		dbmodel.saveModel(output, SchemaParser::XmlCode);
+
+		// Relationships are loaded only when all the tables they connect are loaded
+		DatabaseModel filtered_model;
+		filtered_model.createSystemObjects(false);
+		filtered_model.loadModel(output, { QString("table:table_a:%1").arg(UtilsNs::FilterWildcard),
+																			 QString("table:table_b:%1").arg(UtilsNs::FilterWildcard) });
+
+		QVERIFY(filtered_model.getTable("public.table_a") != nullptr);
+		QVERIFY(filtered_model.getTable("public.table_b") != nullptr);
+		QVERIFY(filtered_model.getRelationship("rel_a_b") != nullptr);
+		QVERIFY(filtered_model.getTable("public.table_c") == nullptr);
+		QVERIFY(filtered_model.getRelationship("rel_b_c") == nullptr);
+		QVERIFY(filtered_model.getTable("public.table_child") == nullptr);
+		QVERIFY(filtered_model.getRelationship("rel_child_a") == nullptr);
+
+		// An inheritance relationship is loaded with the child table and pulls in only the parent table
+		DatabaseModel child_model;
+		child_model.createSystemObjects(false);
+		child_model.loadModel(output, { QString("table:table_child:%1").arg(UtilsNs::FilterWildcard) });
+
+		QVERIFY(child_model.getTable("public.table_child") != nullptr);
+		QVERIFY(child_model.getTable("public.table_a") != nullptr);
+		QVERIFY(child_model.getRelationship("rel_child_a") != nullptr);
+		QVERIFY(child_model.getTable("public.table_child")->getColumn("id_table_a") != nullptr);
+		QVERIFY(child_model.getTable("public.table_b") == nullptr);
+		QVERIFY(child_model.getRelationship("rel_a_b") == nullptr);
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::loadChainOfDependentRelationships()
+{
+	DatabaseModel dbmodel;
+	QString output=QFileInfo(BINDIR).absolutePath() + GlobalAttributes::DirSeparator + "rels_chain_test.dbm";
+	QStringList tab_names = { "table_a", "table_b", "table_c", "table_d" };
+
+	try
+	{
+		Schema *schema=nullptr;
+		Table *table=nullptr;
+		Column *col=nullptr;
+		Relationship *rel=nullptr;
+
+		dbmodel.setName("rels_chain_test");
+		dbmodel.createSystemObjects(true);
+		schema=dbmodel.getSchema("public");
+
+		for(auto &tab_name : tab_names)
+		{
+			table=new Table;
+			table->setName(tab_name);
+			table->setSchema(schema);
+
+			col=new Column;
+			col->setName(QString("id_%1").arg(tab_name));
+			col->setType(PgSqlType("integer"));
+			table->addColumn(col);
+
+			dbmodel.addTable(table);
+		}
+
+		/* Creating the inheritance chain table_d -> table_c -> table_b -> table_a in the reverse order
+		 * of their dependencies, so the columns of table_a reach table_d only through the whole chain */
+		for(int idx = tab_names.size() - 1; idx > 0; idx--)
+		{
+			rel=new Relationship(BaseRelationship::RelationshipGen,
+													 dbmodel.getTable("public." + tab_names[idx]),
+													 dbmodel.getTable("public." + tab_names[idx - 1]));
+			rel->setName(QString("rel_%1_%2").arg(tab_names[idx], tab_names[idx - 1]));
+			dbmodel.addRelationship(rel);
+		}
+
+		dbmodel.saveModel(output, SchemaParser::XmlCode);
+
+		DatabaseModel loaded_model;
+		loaded_model.createSystemObjects(false);
+		loaded_model.loadModel(output);
+
+		QCOMPARE(loaded_model.getObjectCount(ObjectType::Relationship), static_cast<unsigned>(tab_names.size() - 1));
+
+		for(int idx = tab_names.size() - 1; idx > 0; idx--)
+		{
+			rel=dynamic_cast<Relationship *>(loaded_model.getRelationship(QString("rel_%1_%2").arg(tab_names[idx], tab_names[idx - 1])));
+			QVERIFY(rel != nullptr);
+			QVERIFY(rel->isRelationshipConnected());
+		}
+
+		// The last table in the chain must have received the columns of all its ancestors
+		table=loaded_model.getTable("public.table_d");
+		QVERIFY(table != nullptr);
+
+		for(auto &tab_name : tab_names)
+			QVERIFY(table->getColumn(QString("id_%1").arg(tab_name)) != nullptr);
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void DatabaseModelTest::recomputeCreationOrderOnObjectsChanges()
+{
+	DatabaseModel dbmodel;
+
+	try
+	{
+		Schema *schema=nullptr;
+		Table *table_a=new Table, *table_b=new Table;
+		Column *col=nullptr;
+		std::map<unsigned, BaseObject *> order;
+
+		auto get_position = [](std::map<unsigned, BaseObject *> &order, BaseObject *object) {
+			int pos = 0;
+
+			for(auto &itr : order)
+			{
+				if(itr.second == object)
+					return pos;
+
+				pos++;
+			}
+
+			return -1;
+		};
+
+		dbmodel.setName("creation_order_test");
+		dbmodel.createSystemObjects(true);
+		schema=dbmodel.getSchema("public");
+
+		table_a->setName("table_a");
+		table_a->setSchema(schema);
+		dbmodel.addTable(table_a);
+
+		table_b->setName("table_b");
+		table_b->setSchema(schema);
+		dbmodel.addTable(table_b);
+
+		order=dbmodel.getCreationOrder(SchemaParser::SqlCode);
+		QVERIFY(get_position(order, table_a) >= 0);
+		QVERIFY(get_position(order, table_a) < get_position(order, table_b));
+
+		// Adding a column directly to the table must be reflected in the creation order
+		col=new Column;
+		col->setName("id");
+		col->setType(PgSqlType("integer"));
+		table_a->addColumn(col);
+
+		order=dbmodel.getCreationOrder(SchemaParser::SqlCode);
+		QVERIFY(get_position(order, col) >= 0);
+
+		// Changing the objects ids in place must reorder the objects
+		BaseObject::swapObjectsIds(table_a, table_b, false);
+
+		order=dbmodel.getCreationOrder(SchemaParser::SqlCode);
+		QVERIFY(get_position(order, table_b) < get_position(order, table_a));
+
+		BaseObject::updateObjectId(table_b);
+
+		order=dbmodel.getCreationOrder(SchemaParser::SqlCode);
+		QVERIFY(get_position(order, table_a) < get_position(order, table_b));
+		QVERIFY(get_position(order, table_b) > get_position(order, col));
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
 QTEST_MAIN(DatabaseModelTest)
 #include "databasemodeltest.moc"
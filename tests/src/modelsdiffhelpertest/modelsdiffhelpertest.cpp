@@ -0,0 +1,139 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "modelsdiffhelper.h"
+#include "pgmodelerunittest.h"
+
+class ModelsDiffHelperTest: public QObject, public PgModelerUnitTest {
+	private:
+		Q_OBJECT
+
+		static constexpr unsigned TableCount = 40;
+
+		/*! \brief Creates a model with several tables and sequences sharing the same schema and owner.
+		 * When changed is true some of the objects are created with a different definition */
+		void createModel(DatabaseModel &model, bool changed);
+
+		//! \brief Runs the diff between the two models using the specified amount of jobs returning the generated code
+		QString runDiff(DatabaseModel &src_model, DatabaseModel &imp_model, unsigned jobs);
+
+	public:
+		ModelsDiffHelperTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private slots:
+		void parallelDiffMatchesSequentialDiff();
+};
+
+void ModelsDiffHelperTest::createModel(DatabaseModel &model, bool changed)
+{
+	Schema *schema = new Schema;
+	Role *role = new Role;
+	Table *table = nullptr;
+	Sequence *seq = nullptr;
+	Column *col = nullptr;
+
+	model.setName("db_diff_test");
+	model.createSystemObjects(true);
+
+	role->setName("diff_owner");
+	model.addRole(role);
+
+	schema->setName("diff_schema");
+	schema->setOwner(role);
+	model.addSchema(schema);
+
+	for(unsigned i = 0; i < TableCount; i++)
+	{
+		table = new Table;
+		table->setName(QString("table_%1").arg(i));
+		table->setSchema(schema);
+		table->setOwner(role);
+
+		if(changed && i % 2 == 0)
+			table->setComment(QString("Comment of table_%1").arg(i));
+
+		col = new Column;
+		col->setName("id");
+		col->setType(PgSqlType("integer"));
+		col->setNotNull(true);
+		table->addColumn(col);
+
+		col = new Column;
+		col->setName("description");
+		col->setType(changed && i % 3 == 0 ? PgSqlType("text") : PgSqlType("varchar", 1, 30));
+		table->addColumn(col);
+
+		model.addTable(table);
+
+		seq = new Sequence;
+		seq->setName(QString("seq_%1").arg(i));
+		seq->setSchema(schema);
+		seq->setOwner(role);
+		seq->setValues("1", "2147483647", "1", changed && i % 5 == 0 ? "10" : "1", "1");
+		model.addSequence(seq);
+	}
+}
+
+QString ModelsDiffHelperTest::runDiff(DatabaseModel &src_model, DatabaseModel &imp_model, unsigned jobs)
+{
+	ModelsDiffHelper diff_hlp;
+	QString error;
+
+	connect(&diff_hlp, &ModelsDiffHelper::s_diffAborted, this, [&error](Exception e){
+		error = e.getExceptionsText();
+	});
+
+	diff_hlp.setModels(&src_model, &imp_model);
+	diff_hlp.setDiffJobs(jobs);
+	diff_hlp.diffModels();
+
+	if(!error.isEmpty())
+		QTest::qFail(error.toStdString().c_str(), __FILE__, __LINE__);
+
+	return diff_hlp.getDiffDefinition();
+}
+
+void ModelsDiffHelperTest::parallelDiffMatchesSequentialDiff()
+{
+	try
+	{
+		DatabaseModel src_model, imp_model;
+		QString seq_diff, par_diff;
+
+		createModel(src_model, true);
+		createModel(imp_model, false);
+
+		seq_diff = runDiff(src_model, imp_model, 1);
+		QVERIFY(!seq_diff.isEmpty());
+
+		// Running the diff more than once to increase the chances of exposing concurrency issues
+		for(unsigned i = 0; i < 5; i++)
+		{
+			par_diff = runDiff(src_model, imp_model, 4);
+			QCOMPARE(par_diff, seq_diff);
+		}
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+QTEST_MAIN(ModelsDiffHelperTest)
+#include "modelsdiffhelpertest.moc"
@@ -0,0 +1,289 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include "operationlist.h"
+#include "pgmodelerunittest.h"
+
+class OperationListTest: public QObject, public PgModelerUnitTest {
+	private:
+		Q_OBJECT
+
+		//! \brief Creates a table in the provided model placed at the origin of the canvas
+		Table *createTable(DatabaseModel &model, const QString &name);
+
+		//! \brief Registers the movement of the table in the operation list and moves it to the provided position
+		void moveTable(OperationList &op_list, Table *table, const QPointF &pos);
+
+	public:
+		OperationListTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private slots:
+		void undoRedoRepeatedMoves();
+		void newOperationTruncatesRedoOperations();
+		void journaledOperationsRoundTrip();
+		void removeOldestOperationsOnMemoryLimit();
+};
+
+Table *OperationListTest::createTable(DatabaseModel &model, const QString &name)
+{
+	Table *table = new Table;
+
+	table->setName(name);
+	table->setSchema(model.getSchema("public"));
+	table->setPosition(QPointF(0, 0));
+	model.addTable(table);
+
+	return table;
+}
+
+void OperationListTest::moveTable(OperationList &op_list, Table *table, const QPointF &pos)
+{
+	op_list.registerObject(table, Operation::ObjMoved);
+	table->setPosition(pos);
+}
+
+void OperationListTest::undoRedoRepeatedMoves()
+{
+	try
+	{
+		DatabaseModel model;
+		OperationList op_list(&model);
+		Table *table = nullptr;
+
+		model.createSystemObjects(true);
+		table = createTable(model, "table_a");
+
+		moveTable(op_list, table, QPointF(10, 10));
+		moveTable(op_list, table, QPointF(20, 20));
+		moveTable(op_list, table, QPointF(30, 30));
+		QCOMPARE(op_list.getCurrentSize(), 3u);
+
+		op_list.undoOperation();
+		QCOMPARE(table->getPosition(), QPointF(20, 20));
+
+		op_list.undoOperation();
+		QCOMPARE(table->getPosition(), QPointF(10, 10));
+
+		op_list.undoOperation();
+		QCOMPARE(table->getPosition(), QPointF(0, 0));
+		QVERIFY(!op_list.isUndoAvailable());
+
+		op_list.redoOperation();
+		QCOMPARE(table->getPosition(), QPointF(10, 10));
+
+		op_list.redoOperation();
+		op_list.redoOperation();
+		QCOMPARE(table->getPosition(), QPointF(30, 30));
+		QVERIFY(!op_list.isRedoAvailable());
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void OperationListTest::newOperationTruncatesRedoOperations()
+{
+	try
+	{
+		DatabaseModel model;
+		OperationList op_list(&model);
+		Table *table = nullptr, *other_table = nullptr;
+
+		model.createSystemObjects(true);
+		table = createTable(model, "table_a");
+		other_table = createTable(model, "table_b");
+
+		moveTable(op_list, table, QPointF(10, 10));
+		moveTable(op_list, table, QPointF(20, 20));
+		moveTable(op_list, table, QPointF(30, 30));
+
+		/* Undoing the last two moves and registering a new one over the same object.
+		 * The undone operations must be discarded even though the table is still in the pool */
+		op_list.undoOperation();
+		op_list.undoOperation();
+		QCOMPARE(table->getPosition(), QPointF(10, 10));
+
+		moveTable(op_list, table, QPointF(50, 50));
+		QCOMPARE(op_list.getCurrentSize(), 2u);
+		QCOMPARE(op_list.getCurrentIndex(), 2);
+		QVERIFY(!op_list.isRedoAvailable());
+
+		op_list.undoOperation();
+		QCOMPARE(table->getPosition(), QPointF(10, 10));
+
+		op_list.undoOperation();
+		QCOMPARE(table->getPosition(), QPointF(0, 0));
+		QVERIFY(!op_list.isUndoAvailable());
+
+		op_list.redoOperation();
+		op_list.redoOperation();
+		QCOMPARE(table->getPosition(), QPointF(50, 50));
+
+		// Truncating the redo operations of an object must not affect the operations of the others
+		moveTable(op_list, other_table, QPointF(5, 5));
+		op_list.undoOperation();
+		op_list.undoOperation();
+		QCOMPARE(table->getPosition(), QPointF(10, 10));
+
+		moveTable(op_list, table, QPointF(60, 60));
+		QCOMPARE(op_list.getCurrentSize(), 2u);
+
+		op_list.undoOperation();
+		op_list.undoOperation();
+		QCOMPARE(table->getPosition(), QPointF(0, 0));
+		QCOMPARE(other_table->getPosition(), QPointF(0, 0));
+	}
+	catch (Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void OperationListTest::journaledOperationsRoundTrip()
+{
+	unsigned max_mem = OperationList::getMaximumMemory();
+
+	try
+	{
+		static constexpr unsigned OperCount = 200;
+		DatabaseModel model;
+		OperationList op_list(&model);
+		Table *table = nullptr;
+		Domain *domain = new Domain;
+		Column *col = new Column;
+		std::vector<QString> comments;
+
+		model.createSystemObjects(true);
+		OperationList::setMaximumMemory(1);
+
+		domain->setName("dom_test");
+		domain->setSchema(model.getSchema("public"));
+		domain->setType(PgSqlType("integer"));
+		model.addDomain(domain);
+
+		/* Columns using user defined types have their XML definition stored in the operation.
+		 * Long comments are used so these definitions must be moved to the journal to respect the memory limit */
+		table = createTable(model, "table_a");
+		col->setName("id");
+		col->setType(PgSqlType(domain));
+		table->addColumn(col);
+
+		for(unsigned i = 0; i <= OperCount; i++)
+			comments.push_back(QString(5000, QChar('a' + (i % 26))) + QString::number(i));
+
+		col->setComment(comments[0]);
+
+		for(unsigned i = 1; i <= OperCount; i++)
+		{
+			op_list.registerObject(col, Operation::ObjModified, -1, table);
+			col->setComment(comments[i]);
+		}
+
+		// All the operations must be kept since moving the definitions to the journal is enough to respect the limit
+		QCOMPARE(op_list.getCurrentSize(), OperCount);
+		QVERIFY(op_list.getMemoryUsage() <= 1048576);
+
+		for(int i = OperCount - 1; i >= 0; i--)
+		{
+			op_list.undoOperation();
+			col = table->getColumn("id");
+			QCOMPARE(col->getComment(), comments[i]);
+			QVERIFY(col->getType() == domain);
+		}
+
+		QVERIFY(!op_list.isUndoAvailable());
+
+		for(unsigned i = 1; i <= OperCount; i++)
+		{
+			op_list.redoOperation();
+			col = table->getColumn("id");
+			QCOMPARE(col->getComment(), comments[i]);
+		}
+	}
+	catch (Exception &e)
+	{
+		OperationList::setMaximumMemory(max_mem);
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+
+	OperationList::setMaximumMemory(max_mem);
+}
+
+void OperationListTest::removeOldestOperationsOnMemoryLimit()
+{
+	unsigned max_mem = OperationList::getMaximumMemory();
+
+	try
+	{
+		DatabaseModel model;
+		OperationList op_list(&model);
+		Table *table = nullptr;
+		Column *col = nullptr;
+
+		model.createSystemObjects(true);
+		OperationList::setMaximumMemory(1);
+
+		/* Each modification of a table with 150 columns is estimated in about 300KB
+		 * so only three of them fit in the memory limit of the list */
+		table = createTable(model, "table_a");
+
+		for(unsigned i = 0; i < 150; i++)
+		{
+			col = new Column;
+			col->setName(QString("col_%1").arg(i));
+			col->setType(PgSqlType("integer"));
+			table->addColumn(col);
+		}
+
+		for(unsigned i = 0; i < 5; i++)
+		{
+			op_list.registerObject(table, Operation::ObjModified);
+			table->setComment(QString("comment %1").arg(i + 1));
+		}
+
+		// Only the oldest operations must be discarded instead of the whole history
+		QCOMPARE(op_list.getCurrentSize(), 3u);
+		QCOMPARE(op_list.getCurrentIndex(), 3);
+		QVERIFY(op_list.getMemoryUsage() <= 1048576);
+
+		op_list.undoOperation();
+		QCOMPARE(table->getComment(), QString("comment 4"));
+
+		op_list.undoOperation();
+		op_list.undoOperation();
+		QCOMPARE(table->getComment(), QString("comment 2"));
+		QVERIFY(!op_list.isUndoAvailable());
+
+		op_list.redoOperation();
+		op_list.redoOperation();
+		op_list.redoOperation();
+		QCOMPARE(table->getComment(), QString("comment 5"));
+	}
+	catch (Exception &e)
+	{
+		OperationList::setMaximumMemory(max_mem);
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+
+	OperationList::setMaximumMemory(max_mem);
+}
+
+QTEST_MAIN(OperationListTest)
+#include "operationlisttest.moc"
@@ -0,0 +1,195 @@
+/*
+# PostgreSQL Database Modeler (pgModeler)
+#
+# Copyright 2006-2023 - Raphael Araújo e Silva <raphael@pgmodeler.io>
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation version 3.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# The complete text of GPLv3 is at LICENSE file on source code root directory.
+# Also, you can get the complete GNU General Public License at <http://www.gnu.org/licenses/>
+*/
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+#include "databasemodel.h"
+#include "pgmodelerunittest.h"
+
+class PgModelerCliTest: public QObject, public PgModelerUnitTest {
+	private:
+		Q_OBJECT
+
+		static constexpr int JobCount = 4;
+
+		//! \brief Saves a model containing a single table in the provided file
+		void createModelFile(const QString &filename);
+
+		/*! \brief Runs pgmodeler-cli with the provided arguments writing the input data to its
+		 * standard input. Returns the exit code of the process or -1 if it doesn't finish normally */
+		int runCli(const QStringList &args, const QByteArray &input = {});
+
+		/*! \brief Runs pgmodeler-cli in batch mode reading the jobs from the standard input, using the provided
+		 * amount of parallel jobs. Returns the exit code of the process */
+		int runBatch(const QStringList &jobs, unsigned batch_jobs);
+
+	public:
+		PgModelerCliTest() : PgModelerUnitTest(SCHEMASDIR){}
+
+	private slots:
+		void runBatchJobsFromStdInput();
+		void runBatchWithFailedJob();
+		void diffSnapshotAgainstSourceDatabase();
+};
+
+void PgModelerCliTest::createModelFile(const QString &filename)
+{
+	DatabaseModel dbmodel;
+	Table *table = new Table;
+	Column *col = new Column;
+
+	dbmodel.setName("cli_batch_test");
+	dbmodel.createSystemObjects(true);
+
+	table->setName("table_a");
+	table->setSchema(dbmodel.getSchema("public"));
+
+	col->setName("id");
+	col->setType(PgSqlType("integer"));
+	table->addColumn(col);
+
+	dbmodel.addTable(table);
+	dbmodel.saveModel(filename, SchemaParser::XmlCode);
+}
+
+int PgModelerCliTest::runCli(const QStringList &args, const QByteArray &input)
+{
+	QProcess cli;
+
+	cli.start(GlobalAttributes::getPgModelerCLIPath(), args + QStringList { "--silent" });
+
+	if(!cli.waitForStarted())
+		return -1;
+
+	cli.write(input);
+	cli.closeWriteChannel();
+
+	if(!cli.waitForFinished(120000) || cli.exitStatus() != QProcess::NormalExit)
+		return -1;
+
+	return cli.exitCode();
+}
+
+int PgModelerCliTest::runBatch(const QStringList &jobs, unsigned batch_jobs)
+{
+	// Blank lines and comments must be ignored by the batch mode
+	return runCli({ "--batch", "-", "--batch-jobs", QString::number(batch_jobs) },
+								"# Jobs generated by the batch test\n\n" + jobs.join('\n').toUtf8() + "\n");
+}
+
+void PgModelerCliTest::runBatchJobsFromStdInput()
+{
+	if(!QFileInfo::exists(GlobalAttributes::getPgModelerCLIPath()))
+		QSKIP("pgmodeler-cli executable not found!");
+
+	try
+	{
+		QTemporaryDir tmp_dir;
+		QString input = tmp_dir.filePath("batch_model.dbm");
+		QStringList jobs, outputs;
+		QFile output;
+
+		QVERIFY(tmp_dir.isValid());
+		createModelFile(input);
+
+		for(int idx = 0; idx < JobCount; idx++)
+		{
+			outputs.append(tmp_dir.filePath(QString("batch_output_%1.sql").arg(idx)));
+			jobs.append(QString("--export-to-file --input \"%1\" --output \"%2\"").arg(input, outputs.last()));
+		}
+
+		QCOMPARE(runBatch(jobs, 2), 0);
+
+		for(auto &out_file : outputs)
+		{
+			output.setFileName(out_file);
+			QVERIFY(output.open(QFile::ReadOnly));
+			QVERIFY(output.readAll().contains("CREATE TABLE public.table_a"));
+			output.close();
+		}
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void PgModelerCliTest::runBatchWithFailedJob()
+{
+	if(!QFileInfo::exists(GlobalAttributes::getPgModelerCLIPath()))
+		QSKIP("pgmodeler-cli executable not found!");
+
+	try
+	{
+		QTemporaryDir tmp_dir;
+		QString input = tmp_dir.filePath("batch_model.dbm");
+		QStringList jobs, outputs;
+
+		QVERIFY(tmp_dir.isValid());
+		createModelFile(input);
+
+		for(int idx = 0; idx < JobCount; idx++)
+		{
+			outputs.append(tmp_dir.filePath(QString("batch_output_%1.sql").arg(idx)));
+
+			// The second job refers to an inexistent model so it must fail without aborting the others
+			jobs.append(QString("--export-to-file --input \"%1\" --output \"%2\"")
+									.arg(idx == 1 ? tmp_dir.filePath("inexistent.dbm") : input, outputs.last()));
+		}
+
+		QVERIFY(runBatch(jobs, 2) != 0);
+
+		for(int idx = 0; idx < JobCount; idx++)
+			QCOMPARE(QFileInfo::exists(outputs[idx]), idx != 1);
+	}
+	catch(Exception &e)
+	{
+		QFAIL(e.getExceptionsText().toStdString().c_str());
+	}
+}
+
+void PgModelerCliTest::diffSnapshotAgainstSourceDatabase()
+{
+	/* This test needs a live server, so it's executed only when a connection alias (configured in
+	 * the connections settings) and the database to be captured are provided via environment variables */
+	QString conn_alias = qgetenv("PGMODELER_TEST_CONN_ALIAS"),
+			dbname = qgetenv("PGMODELER_TEST_DB");
+
+	if(!QFileInfo::exists(GlobalAttributes::getPgModelerCLIPath()))
+		QSKIP("pgmodeler-cli executable not found!");
+
+	if(conn_alias.isEmpty() || dbname.isEmpty())
+		QSKIP("PGMODELER_TEST_CONN_ALIAS and PGMODELER_TEST_DB not set!");
+
+	QTemporaryDir tmp_dir;
+	QString snapshot = tmp_dir.filePath("catalog.snapshot"),
+			diff_file = tmp_dir.filePath("snapshot_diff.sql");
+
+	QVERIFY(tmp_dir.isValid());
+
+	QCOMPARE(runCli({ "--create-snapshot", "--conn-alias", conn_alias, "--input-db", dbname, "--output", snapshot }), 0);
+	QVERIFY(QFileInfo(snapshot).size() > 0);
+
+	// Comparing the live database to its own snapshot must not produce any difference, so no diff file is saved
+	QCOMPARE(runCli({ "--diff", "--conn-alias", conn_alias, "--input-db", dbname,
+										"--compare-to-snapshot", snapshot, "--save", "--output", diff_file }), 0);
+	QVERIFY(!QFileInfo::exists(diff_file));
+}
+
+QTEST_MAIN(PgModelerCliTest)
+#include "pgmodelerclitest.moc"
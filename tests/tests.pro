@@ -18,3 +18,7 @@ src/xmlparsertest \
 src/proceduretest \
 src/basefunctiontest \
 src/csvparsertest \
+src/modelsdiffhelpertest \
+src/operationlisttest \
+src/pgmodelerclitest \
+benchmarks